@@ -0,0 +1,238 @@
+/**
+ * @file FlyingPhasorBufferPool.cpp
+ * @brief The Implementation file for the Flying Phasor Buffer Pool
+ *
+ * The arena is one anonymous mapping where the platform has mmap and, one heap allocation where it does not.
+ * Either way, it is over reserved by enough to round its start up to the requested alignment. Each buffer's
+ * stride is rounded up to the alignment as well, so that every buffer begins on a boundary.
+ *
+ * Explicit huge pages (MAP_HUGETLB) are only available where the administrator has reserved them. When that
+ * mapping fails, we map normal pages and advise the kernel that transparent huge pages are welcome. Locking
+ * maps in every page as a side effect. Pre-faulting writes one byte per page, which is enough to have the
+ * kernel provide it. The anonymous mapping is already zeroed, so writing zeros changes nothing else.
+ *
+ * The free list is a stack of buffer indices, sized once at construction. Acquiring pops and releasing pushes.
+ * A flag per buffer catches releasing a buffer twice.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorBufferPool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/mman.h>
+#include <unistd.h>
+#define REISER_RT_FLYING_PHASOR_HAVE_MMAP 1
+#endif
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The size of an explicit huge page. We assume the common default of 2MB. A mapping rounded up to
+    // a multiple of this is also a multiple of any smaller huge page size.
+    constexpr size_t hugePageSize = size_t( 2 ) << 20;
+
+    constexpr size_t roundUp( size_t value, size_t multiple )
+    {
+        return ( value + multiple - 1 ) / multiple * multiple;
+    }
+}
+
+class FlyingPhasorBufferPool::Imple
+{
+public:
+    Imple( size_t theNumBuffers, size_t theSamplesPerBuffer, const Options & options )
+        : numBuffers{ theNumBuffers }
+        , samplesPerBuffer{ theSamplesPerBuffer }
+        , strideBytes{ roundUp( theSamplesPerBuffer * sizeof( FlyingPhasorElementType ), options.alignment ) }
+        , freeStack( theNumBuffers )
+        , acquired( theNumBuffers, false )
+    {
+        reserveArena( strideBytes * numBuffers, options );
+
+        // Buffer zero is handed out first.
+        for ( size_t i = 0; numBuffers != i; ++i )
+            freeStack[ i ] = numBuffers - 1 - i;
+        numFree = numBuffers;
+    }
+
+    ~Imple()
+    {
+#ifdef REISER_RT_FLYING_PHASOR_HAVE_MMAP
+        if ( locked )
+            munlock( pMapping, mappingBytes );
+        munmap( pMapping, mappingBytes );
+#else
+        delete[] static_cast< char * >( pMapping );
+#endif
+    }
+
+    FlyingPhasorElementBufferTypePtr acquire()
+    {
+        if ( 0 == numFree )
+            return nullptr;
+
+        const size_t index = freeStack[ --numFree ];
+        acquired[ index ] = true;
+        return bufferAt( index );
+    }
+
+    void release( FlyingPhasorElementBufferTypePtr pElementBuffer )
+    {
+        if ( nullptr == pElementBuffer )
+            return;
+
+        const auto offset = reinterpret_cast< uintptr_t >( pElementBuffer ) - reinterpret_cast< uintptr_t >( pArena );
+        const size_t index = offset / strideBytes;
+        if ( numBuffers <= index || 0 != offset % strideBytes )
+            throw std::invalid_argument{ "FlyingPhasorBufferPool: buffer does not belong to this pool" };
+        if ( !acquired[ index ] )
+            throw std::invalid_argument{ "FlyingPhasorBufferPool: buffer is not acquired" };
+
+        acquired[ index ] = false;
+        freeStack[ numFree++ ] = index;
+    }
+
+    size_t getBufferCount() const { return numBuffers; }
+    size_t getSamplesPerBuffer() const { return samplesPerBuffer; }
+    size_t getAvailableCount() const { return numFree; }
+    bool usesHugePages() const { return hugePages; }
+    bool isLocked() const { return locked; }
+
+private:
+    FlyingPhasorElementBufferTypePtr bufferAt( size_t index ) const
+    {
+        return reinterpret_cast< FlyingPhasorElementBufferTypePtr >( static_cast< char * >( pArena ) + index * strideBytes );
+    }
+
+    void reserveArena( size_t arenaBytes, const Options & options )
+    {
+        const size_t alignment = options.alignment;
+#ifdef REISER_RT_FLYING_PHASOR_HAVE_MMAP
+        const size_t pageSize = size_t( sysconf( _SC_PAGESIZE ) );
+        const size_t slack = pageSize < alignment ? alignment : 0;
+
+        pMapping = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        if ( options.hugePages )
+        {
+            mappingBytes = roundUp( arenaBytes + ( hugePageSize < alignment ? alignment : 0 ), hugePageSize );
+            pMapping = mmap( nullptr, mappingBytes, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+            hugePages = MAP_FAILED != pMapping;
+        }
+#endif
+        if ( MAP_FAILED == pMapping )
+        {
+            mappingBytes = roundUp( arenaBytes + slack, pageSize );
+            pMapping = mmap( nullptr, mappingBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+            if ( MAP_FAILED == pMapping )
+                throw std::bad_alloc{};
+#ifdef MADV_HUGEPAGE
+            if ( options.hugePages )
+                madvise( pMapping, mappingBytes, MADV_HUGEPAGE );
+#endif
+        }
+
+        if ( options.lockMemory )
+            locked = 0 == mlock( pMapping, mappingBytes );
+
+        if ( options.preFault )
+        {
+            volatile char * const pBytes = static_cast< char * >( pMapping );
+            for ( size_t offset = 0; mappingBytes > offset; offset += pageSize )
+                pBytes[ offset ] = 0;
+        }
+#else
+        mappingBytes = arenaBytes + alignment;
+        pMapping = new char[ mappingBytes ];
+        if ( options.preFault )
+            std::memset( pMapping, 0, mappingBytes );
+#endif
+
+        const auto address = reinterpret_cast< uintptr_t >( pMapping );
+        pArena = reinterpret_cast< void * >( ( address + alignment - 1 ) & ~uintptr_t( alignment - 1 ) );
+    }
+
+private:
+    const size_t numBuffers;
+    const size_t samplesPerBuffer;
+    const size_t strideBytes;
+
+    // The mapping as reserved and, the arena within it, rounded up to the alignment.
+    void * pMapping{ nullptr };
+    size_t mappingBytes{ 0 };
+    void * pArena{ nullptr };
+    bool hugePages{ false };
+    bool locked{ false };
+
+    // The free list. The top numFree entries of freeStack are the indices of free buffers.
+    std::vector< size_t > freeStack;
+    std::vector< bool > acquired;
+    size_t numFree{ 0 };
+};
+
+FlyingPhasorBufferPool::FlyingPhasorBufferPool( size_t numBuffers, size_t samplesPerBuffer, const Options & options )
+    : pImple{ nullptr }
+{
+    if ( 0 == numBuffers || 0 == samplesPerBuffer )
+        throw std::invalid_argument{ "FlyingPhasorBufferPool: numBuffers and samplesPerBuffer must be non-zero" };
+    if ( 16 > options.alignment || 0 != ( options.alignment & ( options.alignment - 1 ) ) )
+        throw std::invalid_argument{ "FlyingPhasorBufferPool: alignment must be a power of two of at least 16" };
+
+    // Guard the arena size computation against overflow. Anything close is unobtainable anyway.
+    const size_t maxBytes = std::numeric_limits< size_t >::max() / 2;
+    if ( maxBytes / sizeof( FlyingPhasorElementType ) / numBuffers < samplesPerBuffer + options.alignment )
+        throw std::bad_alloc{};
+
+    pImple = new Imple{ numBuffers, samplesPerBuffer, options };
+}
+
+FlyingPhasorBufferPool::~FlyingPhasorBufferPool()
+{
+    delete pImple;
+}
+
+FlyingPhasorElementBufferTypePtr FlyingPhasorBufferPool::acquire()
+{
+    return pImple->acquire();
+}
+
+void FlyingPhasorBufferPool::release( FlyingPhasorElementBufferTypePtr pElementBuffer )
+{
+    pImple->release( pElementBuffer );
+}
+
+size_t FlyingPhasorBufferPool::getBufferCount() const
+{
+    return pImple->getBufferCount();
+}
+
+size_t FlyingPhasorBufferPool::getSamplesPerBuffer() const
+{
+    return pImple->getSamplesPerBuffer();
+}
+
+size_t FlyingPhasorBufferPool::getAvailableCount() const
+{
+    return pImple->getAvailableCount();
+}
+
+bool FlyingPhasorBufferPool::usesHugePages() const
+{
+    return pImple->usesHugePages();
+}
+
+bool FlyingPhasorBufferPool::isLocked() const
+{
+    return pImple->isLocked();
+}
@@ -0,0 +1,186 @@
+/**
+ * @file FlyingPhasorBufferPool.h
+ * @brief The Specification file for the Flying Phasor Buffer Pool
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORBUFFERPOOL_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORBUFFERPOOL_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorBufferPool
+         *
+         * Sample buffers allocated with new are only aligned to a whole sample (16 bytes), their pages are faulted
+         * in on first touch and, each allocation is a trip to the heap. None of that belongs in a real-time loop.
+         * FlyingPhasorBufferPool carves a fixed number of equally sized buffers out of a single arena, reserved
+         * once at construction. Every buffer begins on an alignment boundary of the client's choosing (a cache
+         * line by default). The arena may optionally be backed by huge pages, faulted in up front and, locked into
+         * physical memory. Thereafter, acquiring and releasing buffers is constant time, never allocates and,
+         * never touches a page for the first time.
+         *
+         * Huge pages and memory locking are best effort. Where explicit huge pages cannot be mapped, transparent
+         * huge pages are requested instead. Where the arena cannot be locked (e.g., RLIMIT_MEMLOCK), it is left
+         * unlocked. Either outcome may be queried after construction. Where the platform offers neither, the
+         * arena comes from the heap, aligned as requested.
+         *
+         * A pool is not thread safe. Acquire and release from one thread at a time.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorBufferPool
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The arena and free list are hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Buffer Pool Options
+             *
+             * How the arena is to be reserved.
+             */
+            struct Options
+            {
+                /**
+                 * @brief Default Options
+                 *
+                 * Cache line alignment and pre-faulting, without huge pages or locking.
+                 */
+                Options() : alignment{ 64 }, hugePages{ false }, preFault{ true }, lockMemory{ false } {}
+
+                /**
+                 * @brief The alignment of each buffer in bytes. A power of two, no less than 16.
+                 */
+                size_t alignment;
+
+                /**
+                 * @brief Back the arena with huge pages, if possible.
+                 */
+                bool hugePages;
+
+                /**
+                 * @brief Touch every page of the arena at construction, so that no page fault is taken later.
+                 */
+                bool preFault;
+
+                /**
+                 * @brief Lock the arena into physical memory, if possible, so that it is never paged out.
+                 */
+                bool lockMemory;
+            };
+
+            /**
+             * @brief Construct a Flying Phasor Buffer Pool Instance
+             *
+             * This operation reserves the arena and prepares it as the options ask. This is the only operation
+             * that allocates.
+             *
+             * @param numBuffers The number of buffers in the pool.
+             * @param samplesPerBuffer The number of samples each buffer holds.
+             * @param options How the arena is to be reserved.
+             *
+             * @throw Throws std::invalid_argument if numBuffers or samplesPerBuffer is zero or, the alignment
+             * is not a power of two of at least 16 bytes.
+             * @throw Throws std::bad_alloc if the arena cannot be reserved.
+             */
+            FlyingPhasorBufferPool( size_t numBuffers, size_t samplesPerBuffer, const Options & options=Options{} );
+
+            /**
+             * @brief Destruct a Flying Phasor Buffer Pool Instance
+             *
+             * This operation releases the arena. Any buffer still acquired becomes invalid.
+             */
+            ~FlyingPhasorBufferPool();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorBufferPool( const FlyingPhasorBufferPool & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorBufferPool & operator=( const FlyingPhasorBufferPool & ) = delete;
+
+            /**
+             * @brief Acquire Operation
+             *
+             * This operation hands out a free buffer in constant time. The buffer most recently released is
+             * handed out first, as it is the most likely to still be in cache. Its contents are whatever was
+             * last left there.
+             *
+             * @return Returns a buffer of samplesPerBuffer samples or, null if every buffer is in use.
+             */
+            FlyingPhasorElementBufferTypePtr acquire();
+
+            /**
+             * @brief Release Operation
+             *
+             * This operation returns a buffer to the pool in constant time. Releasing null does nothing.
+             *
+             * @param pElementBuffer A buffer previously acquired from this pool.
+             *
+             * @throw Throws std::invalid_argument if pElementBuffer is not a buffer of this pool or,
+             * is not currently acquired.
+             */
+            void release( FlyingPhasorElementBufferTypePtr pElementBuffer );
+
+            /**
+             * @brief Get Buffer Count
+             *
+             * @return Returns the number of buffers in the pool.
+             */
+            size_t getBufferCount() const;
+
+            /**
+             * @brief Get Samples Per Buffer
+             *
+             * @return Returns the number of samples each buffer holds.
+             */
+            size_t getSamplesPerBuffer() const;
+
+            /**
+             * @brief Get Available Count
+             *
+             * @return Returns the number of buffers currently free to be acquired.
+             */
+            size_t getAvailableCount() const;
+
+            /**
+             * @brief Uses Huge Pages
+             *
+             * @return Returns true if the arena is mapped with explicit huge pages. Transparent huge pages,
+             * which the kernel applies at its own discretion, are not reported.
+             */
+            bool usesHugePages() const;
+
+            /**
+             * @brief Is Locked
+             *
+             * @return Returns true if the arena is locked into physical memory.
+             */
+            bool isLocked() const;
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORBUFFERPOOL_H
@@ -0,0 +1,268 @@
+/**
+ * @file FlyingPhasorChirpGenerator.h
+ * @brief The Specification file for the Flying Phasor Chirp Generator
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORCHIRPGENERATOR_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORCHIRPGENERATOR_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorChirpGenerator
+         *
+         * This is the swept frequency counterpart of FlyingPhasorToneGenerator. Where the tone generator
+         * advances its phasor by a fixed rate phasor each sample, the chirp generator also advances
+         * the rate phasor itself, by an "acceleration" phasor, each sample. That second order recursion
+         * yields a quadratic phase progression (linear frequency sweep) with two complex multiplies per
+         * sample and no trig functions.
+         *
+         * Linear (LFM) and exponential (log) sweeps are supported. An exponential sweep's frequency
+         * is not a polynomial in time and so, cannot be produced by any finite recursion alone. For those,
+         * the acceleration phasor is itself advanced by a "jerk" phasor (a third order recursion) and, every
+         * segment of 64 samples, the rate, acceleration and jerk phasors are re-derived from the closed form
+         * such that phase at the end of the segment is exact (to rounding). The phasor itself is never
+         * re-derived. The waveform is phase continuous throughout, including across invocations.
+         * Linear sweeps re-derive their rate phasor the same way, which keeps it from drifting over
+         * very long sweeps.
+         *
+         * The sweep runs from the start rate to the stop rate over the sweep length in samples. It does
+         * not stop there. The sweep carries on at the same chirp rate (or ratio) until reset.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorChirpGenerator
+        {
+        public:
+            /**
+             * @brief Chirp Type
+             *
+             * Linear sweeps change frequency by a fixed number of radians per sample each sample.
+             * Exponential sweeps change frequency by a fixed ratio each sample.
+             */
+            enum class ChirpType : int
+            {
+                Linear=0, Exponential
+            };
+
+            /**
+             * @brief Construct a Flying Phasor Chirp Generator Instance
+             *
+             * This operation constructs a FlyingPhasorChirpGenerator instance.
+             *
+             * @param startRadiansPerSample The instantaneous frequency of the first sample in radians per sample.
+             * @param stopRadiansPerSample The instantaneous frequency at sweepLength samples in radians per sample.
+             * @param sweepLength The number of samples over which to sweep from start to stop. Must be non-zero.
+             * @param chirpType The type of sweep, linear or exponential.
+             * @param phi The initial phase of the state phasor in radians.
+             *
+             * @throw Throws std::invalid_argument if sweepLength is zero or, for exponential sweeps,
+             * if start and stop rates are not both non-zero and of the same sign.
+             */
+            FlyingPhasorChirpGenerator( double startRadiansPerSample, double stopRadiansPerSample, size_t sweepLength,
+                                        ChirpType chirpType=ChirpType::Linear, double phi=0.0 );
+
+            /**
+             * @brief Destruct a Flying Phasor Chirp Generator Instance
+             *
+             * This operation is defaulted. There is nothing to do or clean up.
+             */
+            ~FlyingPhasorChirpGenerator() = default;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples from the chirp generator into the user provided buffer.
+             * The samples are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples from the chirp generator into the user provided buffer.
+             * The samples are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be multiplied against each sample.
+             */
+            void getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   double scalar );
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples from the chirp generator into the user provided buffer.
+             * The samples are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const double * pScalars );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples from the chirp generator into the user provided buffer.
+             * The samples accumulated are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Scaled Operation
+             *
+             * This operation accumulates 'N' number of samples from the chirp generator into the user provided buffer.
+             * The samples accumulated are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar The scalar to be multiplied against each sample before accumulating.
+             */
+            void accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     double scalar );
+
+            /**
+             * @brief Accumulate Samples Scaled Operation
+             *
+             * This operation accumulates 'N' number of samples from the chirp generator into the user provided buffer.
+             * The samples accumulated are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     const double * pScalars );
+
+            /**
+             * @brief Reset Operation
+             *
+             * This operation resets an instance to a known state. Object state is as if the object had just been
+             * constructed with the same parameters.
+             *
+             * @param startRadiansPerSample The instantaneous frequency of the first sample in radians per sample.
+             * @param stopRadiansPerSample The instantaneous frequency at sweepLength samples in radians per sample.
+             * @param sweepLength The number of samples over which to sweep from start to stop. Must be non-zero.
+             * @param chirpType The type of sweep, linear or exponential.
+             * @param phi The initial phase of the state phasor in radians.
+             *
+             * @throw Throws std::invalid_argument under the same conditions as construction. The instance is
+             * left unchanged.
+             */
+            void reset( double startRadiansPerSample, double stopRadiansPerSample, size_t sweepLength,
+                        ChirpType chirpType=ChirpType::Linear, double phi=0.0 );
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * This operation returns the current value of the sample counter.
+             *
+             * @return Returns the current value of the sample counter.
+             */
+            inline size_t getSampleCount() const { return sampleCounter; }
+
+            /**
+             * @brief Get Instantaneous Frequency
+             *
+             * This operation returns the instantaneous frequency, in radians per sample, of the next
+             * sample to be delivered, as given by the closed form of the sweep.
+             *
+             * @return Returns the instantaneous frequency of the next sample.
+             */
+            double getInstantaneousFrequency() const;
+
+            /**
+             * @brief Get Single Sample Operation
+             *
+             * This operation returns a single sample, advancing state towards the next.
+             *
+             * @return Returns a single complex sample advanced from previous state.
+             */
+            FlyingPhasorElementType getSample();
+
+            /**
+             * @brief Peek Next Sample
+             *
+             * This operation exists for uses cases, where querying the current phase of an instance is necessary
+             * without 'working' the machine. The phasor state remains unchanged.
+             */
+            inline const FlyingPhasorElementType & peekNextSample() const { return phasor; }
+
+        private:
+            /**
+             * @brief The Segment Length
+             *
+             * Rate and acceleration phasors are re-derived from the closed form every this many samples.
+             * It must be a power of two.
+             */
+            static constexpr size_t segmentLength = 64;
+
+            /**
+             * @brief The Re-Derive Operation
+             *
+             * Re-derives the rate (and for exponential sweeps, acceleration and jerk) phasors at the start of
+             * a segment. This costs one (or three) sin/cos evaluations per segment.
+             */
+            void reDerive();
+
+            /**
+             * @brief The Advance Operation.
+             *
+             * Advances (rotates) the phasor by the rate and, the rate by the acceleration. For exponential sweeps,
+             * the acceleration is advanced by the jerk. The phasor and rate are normalized
+             * every other sample as FlyingPhasorToneGenerator::normalize does. Declared inline here for efficient
+             * reuse within the implementation.
+             */
+            inline void advance()
+            {
+                if ( 0 == ( sampleCounter & ( segmentLength - 1 ) ) )
+                    reDerive();
+
+                phasor *= rate;
+                rate *= accel;
+                if ( ChirpType::Exponential == type )
+                    accel *= jerk;
+
+                if ( ( sampleCounter++ & 0x1 ) == 0x1 )
+                {
+                    const double d = 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+                    phasor *= d;
+                    const double e = 1.0 - ( rate.real()*rate.real() + rate.imag()*rate.imag() - 1.0 ) / 2.0;
+                    rate *= e;
+                }
+            }
+
+        private:
+            ChirpType type;
+            double startRate;
+            double sweepRate;       // Linear: radians per sample per sample. Exponential: log of the ratio per sample.
+            double incrementScale;  // Exponential: phase increment of the first sample over its frequency.
+            double accelScale;      // Exponential: initial acceleration of a segment as a multiple of its first increment.
+            double jerkScale;       // Exponential: jerk over a segment as a multiple of its first increment.
+            FlyingPhasorElementType phasor;
+            FlyingPhasorElementType rate;
+            FlyingPhasorElementType accel;
+            FlyingPhasorElementType jerk;
+            size_t sampleCounter;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORCHIRPGENERATOR_H
@@ -0,0 +1,204 @@
+/**
+ * @file FlyingPhasorChunkProducer.cpp
+ * @brief The Implementation file for the Flying Phasor Chunk Producer
+ *
+ * The ring is a classic single producer, single consumer queue. Each side owns one monotonically increasing
+ * index and only ever reads the other's. Chunk i lives in slot i modulo the chunk count. The producer publishes a
+ * filled chunk by storing its write index with release semantics, after the samples are written. The consumer
+ * returns a chunk by storing its read index with release semantics, after it is done reading. Each side loads the
+ * other's index with acquire semantics, so it sees everything the other did before publishing. Neither side
+ * ever waits on the other within an operation, so the consumer side is wait free. The indices are kept on
+ * separate cache lines so the two threads do not contend for one.
+ *
+ * A retune is posted as a rate and a flag. The producer claims the flag before beginning each chunk and,
+ * applies the rate as a Frequency event at the first sample of the chunk.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorChunkProducer.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Assumed cache line size, for keeping the producer's and consumer's state apart.
+    constexpr size_t cacheLineSize = 64;
+
+    // When the ring is full, the producer yields this many times before it starts sleeping.
+    constexpr int maxYields = 16;
+
+    // And then, sleeps this long at a time.
+    constexpr std::chrono::microseconds idleSleep{ 100 };
+}
+
+class FlyingPhasorChunkProducer::Imple
+{
+public:
+    Imple( double radiansPerSample, double phi, size_t theChunkSize, size_t theNumChunks )
+        : chunkSize{ theChunkSize }
+        , numChunks{ theNumChunks }
+        , ring( theChunkSize * theNumChunks )
+        , gen{ radiansPerSample, phi }
+    {
+        producer = std::thread{ &Imple::produce, this };
+    }
+
+    ~Imple()
+    {
+        stopRequested.store( true, std::memory_order_relaxed );
+        producer.join();
+    }
+
+    const FlyingPhasorElementType * acquireChunk()
+    {
+        const size_t read = readIndex.load( std::memory_order_relaxed );
+        if ( writeIndex.load( std::memory_order_acquire ) == read )
+        {
+            // Only the consumer writes this and so, a load and store will do.
+            underrunCount.store( underrunCount.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+            acquired = false;
+            return nullptr;
+        }
+
+        acquired = true;
+        return &ring[ ( read % numChunks ) * chunkSize ];
+    }
+
+    void releaseChunk()
+    {
+        if ( !acquired )
+            return;
+
+        acquired = false;
+        readIndex.store( readIndex.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    void retune( double radiansPerSample )
+    {
+        pendingRate.store( radiansPerSample, std::memory_order_relaxed );
+        retunePending.store( true, std::memory_order_release );
+    }
+
+    size_t getUnderrunCount() const { return underrunCount.load( std::memory_order_relaxed ); }
+    size_t getChunksProduced() const { return writeIndex.load( std::memory_order_relaxed ); }
+    size_t getChunkSize() const { return chunkSize; }
+    size_t getChunkCount() const { return numChunks; }
+
+private:
+    void produce()
+    {
+        int idleCount = 0;
+        while ( !stopRequested.load( std::memory_order_relaxed ) )
+        {
+            const size_t write = writeIndex.load( std::memory_order_relaxed );
+            if ( write - readIndex.load( std::memory_order_acquire ) == numChunks )
+            {
+                // Full. Wait for the consumer.
+                if ( maxYields > idleCount++ )
+                    std::this_thread::yield();
+                else
+                    std::this_thread::sleep_for( idleSleep );
+                continue;
+            }
+            idleCount = 0;
+
+            auto pChunk = &ring[ ( write % numChunks ) * chunkSize ];
+            if ( retunePending.exchange( false, std::memory_order_acquire ) )
+            {
+                const FlyingPhasorToneGenerator::Event retuneEvent{
+                        0, FlyingPhasorToneGenerator::EventType::Frequency, pendingRate.load( std::memory_order_relaxed ) };
+                gen.getSamplesWithEvents( pChunk, chunkSize, &retuneEvent, 1 );
+            }
+            else
+                gen.getSamples( pChunk, chunkSize );
+
+            writeIndex.store( write + 1, std::memory_order_release );
+        }
+    }
+
+private:
+    const size_t chunkSize;
+    const size_t numChunks;
+    std::vector< FlyingPhasorElementType > ring;
+
+    // Producer thread state.
+    FlyingPhasorToneGenerator gen;
+    std::thread producer{};
+    std::atomic< bool > stopRequested{ false };
+
+    // Written by the producer.
+    char producerPad[ cacheLineSize ]{};
+    std::atomic< size_t > writeIndex{ 0 };
+
+    // Written by the consumer.
+    char consumerPad[ cacheLineSize ]{};
+    std::atomic< size_t > readIndex{ 0 };
+    std::atomic< size_t > underrunCount{ 0 };
+    bool acquired{ false };
+
+    // Written by whoever retunes.
+    char retunePad[ cacheLineSize ]{};
+    std::atomic< double > pendingRate{ 0.0 };
+    std::atomic< bool > retunePending{ false };
+};
+
+FlyingPhasorChunkProducer::FlyingPhasorChunkProducer( double radiansPerSample, double phi,
+                                                      size_t chunkSize, size_t numChunks )
+    : pImple{ nullptr }
+{
+    if ( 0 == chunkSize )
+        throw std::invalid_argument{ "FlyingPhasorChunkProducer: chunkSize must be non-zero" };
+    if ( 2 > numChunks )
+        throw std::invalid_argument{ "FlyingPhasorChunkProducer: at least two chunks are required" };
+
+    pImple = new Imple{ radiansPerSample, phi, chunkSize, numChunks };
+}
+
+FlyingPhasorChunkProducer::~FlyingPhasorChunkProducer()
+{
+    delete pImple;
+}
+
+const FlyingPhasorElementType * FlyingPhasorChunkProducer::acquireChunk()
+{
+    return pImple->acquireChunk();
+}
+
+void FlyingPhasorChunkProducer::releaseChunk()
+{
+    pImple->releaseChunk();
+}
+
+void FlyingPhasorChunkProducer::retune( double radiansPerSample )
+{
+    pImple->retune( radiansPerSample );
+}
+
+size_t FlyingPhasorChunkProducer::getUnderrunCount() const
+{
+    return pImple->getUnderrunCount();
+}
+
+size_t FlyingPhasorChunkProducer::getChunksProduced() const
+{
+    return pImple->getChunksProduced();
+}
+
+size_t FlyingPhasorChunkProducer::getChunkSize() const
+{
+    return pImple->getChunkSize();
+}
+
+size_t FlyingPhasorChunkProducer::getChunkCount() const
+{
+    return pImple->getChunkCount();
+}
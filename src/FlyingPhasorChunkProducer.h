@@ -0,0 +1,147 @@
+/**
+ * @file FlyingPhasorChunkProducer.h
+ * @brief The Specification file for the Flying Phasor Chunk Producer
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORCHUNKPRODUCER_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORCHUNKPRODUCER_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorChunkProducer
+         *
+         * A real-time consumer cannot always afford to generate samples on its own thread. FlyingPhasorChunkProducer
+         * owns a FlyingPhasorToneGenerator and a ring of fixed size chunks, which a dedicated producer thread keeps
+         * filled ahead of the consumer. Chunks are handed to the consumer in place (zero copy) through a
+         * single producer, single consumer queue. The consumer side operations are wait free. They never lock,
+         * block or allocate.
+         *
+         * The tone is continuous from one chunk to the next, exactly as if a single FlyingPhasorToneGenerator had
+         * been asked for one chunk after another. It may be retuned (phase continuous) at any time. A retune takes
+         * effect at the start of the next chunk the producer begins, which may be several chunks after those
+         * already waiting for the consumer.
+         *
+         * Exactly one thread may act as the consumer at a time. When the ring is full, the producer thread
+         * yields briefly and then sleeps in short intervals until the consumer releases a chunk.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorChunkProducer
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The generator, ring and producer thread are hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Construct a Flying Phasor Chunk Producer Instance
+             *
+             * This operation allocates the ring and starts the producer thread, which begins filling chunks
+             * straight away.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the first sample of the first chunk in radians.
+             * @param chunkSize The number of samples per chunk.
+             * @param numChunks The number of chunks in the ring.
+             *
+             * @throw Throws std::invalid_argument if chunkSize is zero or numChunks is less than two.
+             */
+            FlyingPhasorChunkProducer( double radiansPerSample, double phi, size_t chunkSize, size_t numChunks );
+
+            /**
+             * @brief Destruct a Flying Phasor Chunk Producer Instance
+             *
+             * This operation stops and joins the producer thread and releases the ring. Any chunk
+             * pointer previously acquired becomes invalid.
+             */
+            ~FlyingPhasorChunkProducer();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorChunkProducer( const FlyingPhasorChunkProducer & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorChunkProducer & operator=( const FlyingPhasorChunkProducer & ) = delete;
+
+            /**
+             * @brief Acquire Chunk Operation
+             *
+             * This operation returns the oldest filled chunk, in place. It remains the consumer's until released.
+             * Acquiring again without releasing returns the same chunk. This operation is wait free.
+             *
+             * @return Returns a pointer to chunkSize samples or, null if no chunk is ready, which counts as an underrun.
+             */
+            const FlyingPhasorElementType * acquireChunk();
+
+            /**
+             * @brief Release Chunk Operation
+             *
+             * This operation hands the chunk last acquired back to the producer for refilling. Releasing without
+             * having acquired a chunk does nothing. This operation is wait free.
+             */
+            void releaseChunk();
+
+            /**
+             * @brief Retune Operation
+             *
+             * This operation changes the frequency, phase continuous, starting with the next chunk the producer
+             * begins. It may be invoked from any one thread at a time and, is wait free.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             */
+            void retune( double radiansPerSample );
+
+            /**
+             * @brief Get Underrun Count
+             *
+             * @return Returns the number of times acquireChunk found no chunk ready.
+             */
+            size_t getUnderrunCount() const;
+
+            /**
+             * @brief Get Chunks Produced Count
+             *
+             * @return Returns the number of chunks the producer has filled so far.
+             */
+            size_t getChunksProduced() const;
+
+            /**
+             * @brief Get Chunk Size
+             *
+             * @return Returns the number of samples per chunk.
+             */
+            size_t getChunkSize() const;
+
+            /**
+             * @brief Get Chunk Count
+             *
+             * @return Returns the number of chunks in the ring.
+             */
+            size_t getChunkCount() const;
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORCHUNKPRODUCER_H
@@ -0,0 +1,171 @@
+/**
+ * @file FlyingPhasorDownConverter.cpp
+ * @brief The Implementation file for the Flying Phasor Digital Down Converter
+ *
+ * Input is mixed a chunk at a time into a working buffer, just after the last ( numTaps - 1 ) mixed samples of
+ * the previous chunk. Each output due within the chunk is then the dot product of the taps with the mixed
+ * samples leading up to it, all found in the working buffer. Finally, the tail of the chunk is moved to the
+ * front of the working buffer to serve as history for the next. Only one in every 'decimation' filter outputs
+ * is ever evaluated.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorDownConverter.h"
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Taps of the non-recursive equivalent of a CIC, ( 1 + z^-1 + ... + z^-(R-1) )^N, normalized by R^N.
+    // The coefficients are integers and so, are formed exactly before normalizing, up to 2^53.
+    std::vector< double > cicTaps( size_t decimation, unsigned int cicOrder )
+    {
+        std::vector< double > taps{ 1.0 };
+        for ( unsigned int stage = 0; cicOrder != stage; ++stage )
+        {
+            std::vector< double > next( taps.size() + decimation - 1, 0.0 );
+            for ( size_t i = 0; taps.size() != i; ++i )
+                for ( size_t j = 0; decimation != j; ++j )
+                    next[ i + j ] += taps[ i ];
+            taps.swap( next );
+        }
+
+        const double gain = std::pow( double( decimation ), double( cicOrder ) );
+        for ( auto & tap : taps )
+            tap /= gain;
+
+        return taps;
+    }
+}
+
+class FlyingPhasorDownConverter::Imple
+{
+public:
+    Imple( double theRadiansPerSample, size_t theDecimation, std::vector< double > && theTaps, double phi )
+        : radiansPerSample{ theRadiansPerSample }
+        , decimation{ theDecimation }
+        , taps{ std::move( theTaps ) }
+        , mixer{ theRadiansPerSample, phi }
+        , work( taps.size() - 1 + Detail::flyingPhasorScratchChunkSize )
+        , skip{}
+    {
+    }
+
+    ~Imple() = default;
+
+    size_t process( const FlyingPhasorElementType * pInputBuffer, size_t numInputSamples,
+                    FlyingPhasorElementBufferTypePtr pOutputBuffer )
+    {
+        const size_t historySize = taps.size() - 1;
+        const size_t numTaps = taps.size();
+        size_t numOutputSamples = 0;
+
+        while ( numInputSamples )
+        {
+            const size_t n = std::min( numInputSamples, Detail::flyingPhasorScratchChunkSize );
+            mixer.mixSamples( pInputBuffer, &work[ historySize ], n, true );
+
+            // Output due at chunk position j is the response at work[ historySize + j ].
+            size_t j = skip;
+            for ( ; j < n; j += decimation )
+            {
+                const FlyingPhasorElementType * pNewest = &work[ historySize + j ];
+                double re = 0.0;
+                double im = 0.0;
+                for ( size_t k = 0; numTaps != k; ++k )
+                {
+                    re += taps[ k ] * pNewest[ -std::ptrdiff_t( k ) ].real();
+                    im += taps[ k ] * pNewest[ -std::ptrdiff_t( k ) ].imag();
+                }
+                pOutputBuffer[ numOutputSamples++ ] = FlyingPhasorElementType{ re, im };
+            }
+            skip = j - n;
+
+            // The tail of what we have seen becomes history for the next chunk.
+            std::copy( work.begin() + n, work.begin() + n + historySize, work.begin() );
+
+            pInputBuffer += n;
+            numInputSamples -= n;
+        }
+
+        return numOutputSamples;
+    }
+
+    void reset( double phi )
+    {
+        mixer.reset( radiansPerSample, phi );
+        std::fill( work.begin(), work.end(), FlyingPhasorElementType{} );
+        skip = 0;
+    }
+
+    size_t getDecimation() const { return decimation; }
+    size_t getNumTaps() const { return taps.size(); }
+
+private:
+    const double radiansPerSample;
+    const size_t decimation;
+    const std::vector< double > taps;
+    FlyingPhasorToneGenerator mixer;
+    std::vector< FlyingPhasorElementType > work;    // History followed by the chunk being worked.
+    size_t skip;                                    // Input samples to go before the next output is due.
+};
+
+FlyingPhasorDownConverter::FlyingPhasorDownConverter( double radiansPerSample, size_t decimation,
+                                                      const double * pTaps, size_t numTaps, double phi )
+    : pImple{ nullptr }
+{
+    if ( 0 == decimation )
+        throw std::invalid_argument{ "FlyingPhasorDownConverter: decimation must be non-zero" };
+    if ( 0 == numTaps || nullptr == pTaps )
+        throw std::invalid_argument{ "FlyingPhasorDownConverter: an FIR requires at least one tap" };
+
+    pImple = new Imple{ radiansPerSample, decimation, std::vector< double >( pTaps, pTaps + numTaps ), phi };
+}
+
+FlyingPhasorDownConverter::FlyingPhasorDownConverter( double radiansPerSample, size_t decimation,
+                                                      unsigned int cicOrder, double phi )
+    : pImple{ nullptr }
+{
+    if ( 0 == decimation )
+        throw std::invalid_argument{ "FlyingPhasorDownConverter: decimation must be non-zero" };
+    if ( 0 == cicOrder )
+        throw std::invalid_argument{ "FlyingPhasorDownConverter: a CIC requires at least one stage" };
+
+    pImple = new Imple{ radiansPerSample, decimation, cicTaps( decimation, cicOrder ), phi };
+}
+
+FlyingPhasorDownConverter::~FlyingPhasorDownConverter()
+{
+    delete pImple;
+}
+
+size_t FlyingPhasorDownConverter::process( const FlyingPhasorElementType * pInputBuffer, size_t numInputSamples,
+                                           FlyingPhasorElementBufferTypePtr pOutputBuffer )
+{
+    return pImple->process( pInputBuffer, numInputSamples, pOutputBuffer );
+}
+
+void FlyingPhasorDownConverter::reset( double phi )
+{
+    pImple->reset( phi );
+}
+
+size_t FlyingPhasorDownConverter::getDecimation() const
+{
+    return pImple->getDecimation();
+}
+
+size_t FlyingPhasorDownConverter::getNumTaps() const
+{
+    return pImple->getNumTaps();
+}
@@ -0,0 +1,145 @@
+/**
+ * @file FlyingPhasorDownConverter.h
+ * @brief The Specification file for the Flying Phasor Digital Down Converter
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORDOWNCONVERTER_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORDOWNCONVERTER_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorDownConverter
+         *
+         * A digital down converter (DDC). Input samples are mixed with the complex conjugate of a
+         * FlyingPhasorToneGenerator tone, which shifts the band of interest down to baseband, then low pass
+         * filtered and decimated, all in a single pass. Mixing is done a chunk at a time into a working buffer
+         * that stays in cache and, the filter is only evaluated at the samples that survive decimation.
+         * The user needs no intermediate buffers.
+         *
+         * The decimation filter is either a user provided FIR or a CIC (cascaded integrator comb) of some order.
+         * A CIC of order N decimating by R is the cascade of N moving sums of length R. Integrators
+         * in floating point grow without bound on any DC content and, lose precision as they do. So here, the
+         * CIC is realized in its equivalent non-recursive form, an FIR whose taps are the coefficients of
+         * ( 1 + z^-1 + ... + z^-(R-1) )^N, normalized for unity gain at DC.
+         *
+         * Output sample m is the filter's response at input sample m * R, counting from construction or the
+         * last reset, with the input before the first sample taken to be zero. Mixer phase and filter history
+         * carry across invocations, so input may be delivered in blocks of any size.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorDownConverter
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The filter taps, history and mixer are hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Construct a Flying Phasor Down Converter Instance with an FIR Decimation Filter
+             *
+             * @param radiansPerSample The frequency, in radians per input sample, to be shifted down to zero.
+             * @param decimation The decimation factor. Only every this many filtered samples are delivered.
+             * @param pTaps The FIR filter taps. They are copied.
+             * @param numTaps The number of FIR filter taps.
+             * @param phi The initial phase of the mixing tone in radians.
+             *
+             * @throw Throws std::invalid_argument if decimation or numTaps is zero, or pTaps is null.
+             */
+            FlyingPhasorDownConverter( double radiansPerSample, size_t decimation, const double * pTaps, size_t numTaps,
+                                       double phi=0.0 );
+
+            /**
+             * @brief Construct a Flying Phasor Down Converter Instance with a CIC Decimation Filter
+             *
+             * @param radiansPerSample The frequency, in radians per input sample, to be shifted down to zero.
+             * @param decimation The decimation factor, which is also the length of the CIC's moving sums.
+             * @param cicOrder The number of CIC stages.
+             * @param phi The initial phase of the mixing tone in radians.
+             *
+             * @throw Throws std::invalid_argument if decimation or cicOrder is zero.
+             */
+            FlyingPhasorDownConverter( double radiansPerSample, size_t decimation, unsigned int cicOrder,
+                                       double phi=0.0 );
+
+            /**
+             * @brief Destruct a Flying Phasor Down Converter Instance
+             *
+             * This operation releases the implementation.
+             */
+            ~FlyingPhasorDownConverter();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorDownConverter( const FlyingPhasorDownConverter & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorDownConverter & operator=( const FlyingPhasorDownConverter & ) = delete;
+
+            /**
+             * @brief Process Operation
+             *
+             * This operation mixes, filters and decimates 'N' number of input samples, delivering
+             * whatever output samples fall due into the user provided output buffer.
+             *
+             * @param pInputBuffer User provided buffer holding the input samples.
+             * @param numInputSamples The number of input samples.
+             * @param pOutputBuffer User provided buffer large enough to hold numInputSamples / decimation + 1
+             * output samples.
+             *
+             * @return Returns the number of output samples delivered.
+             */
+            size_t process( const FlyingPhasorElementType * pInputBuffer, size_t numInputSamples,
+                            FlyingPhasorElementBufferTypePtr pOutputBuffer );
+
+            /**
+             * @brief Reset Operation
+             *
+             * This operation clears the filter history and restarts the mixing tone at the given phase,
+             * as if the object had just been constructed. The frequency, decimation and filter are kept.
+             *
+             * @param phi The initial phase of the mixing tone in radians.
+             */
+            void reset( double phi=0.0 );
+
+            /**
+             * @brief Get Decimation
+             *
+             * @return Returns the decimation factor.
+             */
+            size_t getDecimation() const;
+
+            /**
+             * @brief Get Number of Taps
+             *
+             * @return Returns the number of taps of the decimation filter. For a CIC, this is the length of its
+             * equivalent FIR.
+             */
+            size_t getNumTaps() const;
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORDOWNCONVERTER_H
@@ -0,0 +1,202 @@
+/**
+ * @file FlyingPhasorExactToneGenerator.cpp
+ * @brief The Implementation file for the Flying Phasor Exact Tone Generator
+ *
+ * Between anchors, samples are generated exactly as FlyingPhasorToneGenerator generates them. Requests are
+ * split at anchor boundaries and, each piece is handed to the multi-lane kernels or worked serially, by the
+ * same threshold.
+ *
+ * The exact phase of sample n is phi + n * w, where w is radiansPerSample. Their product is formed without
+ * rounding error as the unevaluated sum of two doubles, hi + lo, hi being the rounded product and lo the
+ * rounding error, recovered with a fused multiply-add. Both n and w are exactly representable as doubles
+ * (n below 2^53) and so, this is exact. The anchor phasor is then exp( j*hi ) * exp( j*( lo + phi ) ).
+ * The standard library's cos and sin reduce even very large arguments such as hi accurately, so the anchor is
+ * good to an ULP or so however far along the tone is. Nothing accumulates from one anchor to the next.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorExactToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+class FlyingPhasorExactToneGenerator::Imple
+{
+public:
+    Imple( double radiansPerSample, double phi, size_t theAnchorPeriod )
+        : anchorPeriod{ theAnchorPeriod }
+    {
+        reset( radiansPerSample, phi );
+    }
+
+    ~Imple() = default;
+
+    void generate( Detail::FlyingPhasorKernelOp op, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                   size_t numSamples, double scalar )
+    {
+        while ( numSamples )
+        {
+            const size_t n = std::min( numSamples, anchorPeriod - sampleCounter % anchorPeriod );
+            generatePiece( op, pElementBuffer, n, scalar );
+            if ( 0 == sampleCounter % anchorPeriod )
+                phasor = exactPhasor( sampleCounter );
+            pElementBuffer += n;
+            numSamples -= n;
+        }
+    }
+
+    void reset( double radiansPerSample, double phi )
+    {
+        omega = radiansPerSample;
+        phase = phi;
+        rate = std::polar( 1.0, radiansPerSample );
+        phasor = std::polar( 1.0, phi );
+        sampleCounter = 0;
+    }
+
+    void seek( size_t sampleIndex )
+    {
+        phasor = exactPhasor( sampleIndex );
+        sampleCounter = sampleIndex;
+    }
+
+    size_t getSampleCount() const { return sampleCounter; }
+    size_t getAnchorPeriod() const { return anchorPeriod; }
+
+    double getUnwrappedPhase() const
+    {
+        double hi, lo;
+        exactProduct( sampleCounter, hi, lo );
+        return hi + ( lo + phase );
+    }
+
+    FlyingPhasorElementType peekNextSample() const { return phasor; }
+
+private:
+    // n * omega as hi + lo, exactly.
+    void exactProduct( size_t n, double & hi, double & lo ) const
+    {
+        const double x = double( n );
+        hi = x * omega;
+        lo = std::fma( x, omega, -hi );
+    }
+
+    FlyingPhasorElementType exactPhasor( size_t n ) const
+    {
+        double hi, lo;
+        exactProduct( n, hi, lo );
+        return std::polar( 1.0, hi ) * std::polar( 1.0, lo + phase );
+    }
+
+    // As FlyingPhasorToneGenerator would, for a request of n samples.
+    void generatePiece( Detail::FlyingPhasorKernelOp op, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                        size_t n, double scalar )
+    {
+        if ( Detail::flyingPhasorUseKernel( n ) )
+        {
+            phasor = Detail::flyingPhasorKernel( op, phasor, rate, pElementBuffer, n, scalar, nullptr );
+            sampleCounter += n;
+            return;
+        }
+
+        for ( size_t i = 0; n != i; ++i )
+        {
+            switch ( op )
+            {
+                case Detail::FlyingPhasorKernelOp::GetScaled: pElementBuffer[ i ] = phasor * scalar; break;
+                case Detail::FlyingPhasorKernelOp::Accum: pElementBuffer[ i ] += phasor; break;
+                case Detail::FlyingPhasorKernelOp::AccumScaled: pElementBuffer[ i ] += phasor * scalar; break;
+                default: pElementBuffer[ i ] = phasor; break;
+            }
+            phasor *= rate;
+
+            // See FlyingPhasorToneGenerator::normalize.
+            if ( ( sampleCounter++ & 0x1 ) == 0x1 )
+            {
+                const double d = 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+                phasor *= d;
+            }
+        }
+    }
+
+private:
+    const size_t anchorPeriod;
+    double omega{};         // Radians per sample, as given.
+    double phase{};         // The initial phase, as given.
+    FlyingPhasorElementType rate{};
+    FlyingPhasorElementType phasor{};
+    size_t sampleCounter{};
+};
+
+FlyingPhasorExactToneGenerator::FlyingPhasorExactToneGenerator( double radiansPerSample, double phi,
+                                                                size_t anchorPeriod )
+    : pImple{ nullptr }
+{
+    if ( 0 == anchorPeriod )
+        throw std::invalid_argument{ "FlyingPhasorExactToneGenerator: anchorPeriod must be non-zero" };
+
+    pImple = new Imple{ radiansPerSample, phi, anchorPeriod };
+}
+
+FlyingPhasorExactToneGenerator::~FlyingPhasorExactToneGenerator()
+{
+    delete pImple;
+}
+
+void FlyingPhasorExactToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( Detail::FlyingPhasorKernelOp::Get, pElementBuffer, numSamples, 1.0 );
+}
+
+void FlyingPhasorExactToneGenerator::getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                       size_t numSamples, double scalar )
+{
+    pImple->generate( Detail::FlyingPhasorKernelOp::GetScaled, pElementBuffer, numSamples, scalar );
+}
+
+void FlyingPhasorExactToneGenerator::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( Detail::FlyingPhasorKernelOp::Accum, pElementBuffer, numSamples, 1.0 );
+}
+
+void FlyingPhasorExactToneGenerator::accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                         size_t numSamples, double scalar )
+{
+    pImple->generate( Detail::FlyingPhasorKernelOp::AccumScaled, pElementBuffer, numSamples, scalar );
+}
+
+void FlyingPhasorExactToneGenerator::reset( double radiansPerSample, double phi )
+{
+    pImple->reset( radiansPerSample, phi );
+}
+
+void FlyingPhasorExactToneGenerator::seek( size_t sampleIndex )
+{
+    pImple->seek( sampleIndex );
+}
+
+size_t FlyingPhasorExactToneGenerator::getSampleCount() const
+{
+    return pImple->getSampleCount();
+}
+
+size_t FlyingPhasorExactToneGenerator::getAnchorPeriod() const
+{
+    return pImple->getAnchorPeriod();
+}
+
+double FlyingPhasorExactToneGenerator::getUnwrappedPhase() const
+{
+    return pImple->getUnwrappedPhase();
+}
+
+FlyingPhasorElementType FlyingPhasorExactToneGenerator::peekNextSample() const
+{
+    return pImple->peekNextSample();
+}
@@ -0,0 +1,197 @@
+/**
+ * @file FlyingPhasorExactToneGenerator.h
+ * @brief The Specification file for the Flying Phasor Exact Tone Generator
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASOREXACTTONEGENERATOR_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASOREXACTTONEGENERATOR_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorExactToneGenerator
+         *
+         * FlyingPhasorToneGenerator advances by a rate phasor rounded once, at construction, from
+         * radiansPerSample. Its angle is off by as much as an ULP or so and, that error accumulates linearly in
+         * phase, sample after sample. Over the short term, that is immeasurable. Over 10^11 samples and more,
+         * it is not. FlyingPhasorExactToneGenerator generates just as FlyingPhasorToneGenerator does but,
+         * every anchorPeriod samples, it re-anchors its phasor to the exact phase phi + n * radiansPerSample,
+         * formed without rounding error from the sample index n. Phase error is thereby bounded by what
+         * accumulates over a single anchor period, no matter how long the tone runs. Re-anchoring costs a pair
+         * each of cos and sin, which amortized over the default period of 65536 samples, is negligible.
+         *
+         * Until the first re-anchor, samples are bit for bit those a FlyingPhasorToneGenerator constructed with
+         * the same parameters would deliver, given the same sequence of request sizes. A request spanning a
+         * re-anchor is worked in two pieces, either side of it.
+         *
+         * The exact phase is also available without resorting to std::arg on the next sample, by way of
+         * getUnwrappedPhase.
+         *
+         * The sample index must stay below 2^53, beyond which it has no exact double precision representation.
+         * At a gigasample per second, that is several months.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorExactToneGenerator
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The generator state is hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Construct a Flying Phasor Exact Tone Generator Instance
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             * @param anchorPeriod The number of samples between re-anchors.
+             *
+             * @throw Throws std::invalid_argument if anchorPeriod is zero.
+             */
+            explicit FlyingPhasorExactToneGenerator( double radiansPerSample=0.0, double phi=0.0,
+                                                     size_t anchorPeriod=65536 );
+
+            /**
+             * @brief Destruct a Flying Phasor Exact Tone Generator Instance
+             *
+             * This operation releases the implementation.
+             */
+            ~FlyingPhasorExactToneGenerator();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorExactToneGenerator( const FlyingPhasorExactToneGenerator & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorExactToneGenerator & operator=( const FlyingPhasorExactToneGenerator & ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are scaled by the scalar provided.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar A scalar value to be multiplied against the samples delivered.
+             */
+            void getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, double scalar );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Scaled Operation
+             *
+             * This operation accumulates 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are scaled by the scalar provided.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar A scalar value to be multiplied against the samples accumulated.
+             */
+            void accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     double scalar );
+
+            /**
+             * @brief Reset Operation
+             *
+             * This operation resets an instance as if it had just been constructed with the same parameters.
+             * The anchor period is retained.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             */
+            void reset( double radiansPerSample=0.0, double phi=0.0 );
+
+            /**
+             * @brief Seek Operation
+             *
+             * This operation positions an instance so that the next sample delivered is the one at the given
+             * sample index, counting from construction or the last reset. It works in constant time, forward
+             * or backward and, the phasor is anchored exactly at the index sought.
+             *
+             * @param sampleIndex The index of the next sample to be delivered.
+             */
+            void seek( size_t sampleIndex );
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered since construction or the last reset, as
+             * adjusted by seek.
+             */
+            size_t getSampleCount() const;
+
+            /**
+             * @brief Get Anchor Period
+             *
+             * @return Returns the number of samples between re-anchors.
+             */
+            size_t getAnchorPeriod() const;
+
+            /**
+             * @brief Get Unwrapped Phase
+             *
+             * This operation returns the exact phase of the next sample, phi + n * radiansPerSample, unwrapped
+             * (i.e., not reduced to any interval), rounded to double precision. No trigonometric function is
+             * involved. Note that as the phase grows, an ULP of it does too. At 10^11 radians, that is
+             * around 1.5e-5 radians.
+             *
+             * @return Returns the unwrapped phase of the next sample in radians.
+             */
+            double getUnwrappedPhase() const;
+
+            /**
+             * @brief Peek Next Sample
+             *
+             * This operation returns the sample to be delivered next, without advancing state.
+             *
+             * @return Returns the next sample.
+             */
+            FlyingPhasorElementType peekNextSample() const;
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASOREXACTTONEGENERATOR_H
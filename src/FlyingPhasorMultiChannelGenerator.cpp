@@ -0,0 +1,247 @@
+/**
+ * @file FlyingPhasorMultiChannelGenerator.cpp
+ * @brief The Implementation file for the Flying Phasor Multi-Channel Generator
+ *
+ * Channel state is kept as separate arrays of real and imaginary components so that, for short blocks, one
+ * step of the recurrence for a group of channels is a handful of loops over contiguous doubles, free of
+ * branches. The complex multiply is written out and, the every other sample normalization of
+ * FlyingPhasorToneGenerator::normalize is folded in by multiplying its correction term by either one or zero
+ * per channel. Either way, the operations are exactly those the serial loop of FlyingPhasorToneGenerator
+ * performs and so, the results agree bit for bit. Channels are worked in groups small enough that their state
+ * and the cache lines of output being filled stay in the L1 data cache.
+ *
+ * Blocks long enough for the multi-lane kernels are handed to them, channel by channel, just as
+ * FlyingPhasorToneGenerator would.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorMultiChannelGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Channels per group for short blocks. 256 channels of state is 8KB, plus a cache line of output each.
+    constexpr size_t groupSize = 256;
+
+    // Output for channel major buffers.
+    struct ChannelMajor
+    {
+        FlyingPhasorElementBufferTypePtr operator()( size_t channel ) const { return pBase + channel * stride; }
+        FlyingPhasorElementBufferTypePtr pBase;
+        size_t stride;
+    };
+
+    // Output for a user provided buffer per channel.
+    struct PerChannel
+    {
+        FlyingPhasorElementBufferTypePtr operator()( size_t channel ) const { return ppBuffers[ channel ]; }
+        const FlyingPhasorElementBufferTypePtr * ppBuffers;
+    };
+}
+
+class FlyingPhasorMultiChannelGenerator::Imple
+{
+public:
+    Imple( size_t numChannels, const double * pRadiansPerSample, const double * pPhis )
+        : rateRe( numChannels ), rateIm( numChannels )
+        , phasorRe( numChannels ), phasorIm( numChannels )
+        , sampleCounters( numChannels )
+        , oddEven( numChannels ), oddOdd( numChannels )
+    {
+        for ( size_t c = 0; numChannels != c; ++c )
+            resetChannel( c, pRadiansPerSample[ c ], pPhis ? pPhis[ c ] : 0.0 );
+    }
+
+    ~Imple() = default;
+
+    size_t getChannelCount() const { return rateRe.size(); }
+
+    template< typename Output >
+    void generate( const Output & output, size_t numSamples, bool accumulate )
+    {
+        if ( Detail::flyingPhasorUseKernel( numSamples ) )
+            generateKernel( output, numSamples, accumulate );
+        else
+        {
+            const size_t numChannels = getChannelCount();
+            for ( size_t c = 0; numChannels > c; c += groupSize )
+                generateGroup( output, c, std::min( groupSize, numChannels - c ), numSamples, accumulate );
+        }
+
+        for ( auto & sampleCounter : sampleCounters )
+            sampleCounter += numSamples;
+    }
+
+    void retuneChannel( size_t channel, double radiansPerSample )
+    {
+        const auto rate = std::polar( 1.0, radiansPerSample );
+        rateRe[ checked( channel ) ] = rate.real();
+        rateIm[ channel ] = rate.imag();
+    }
+
+    void resetChannel( size_t channel, double radiansPerSample, double phi )
+    {
+        retuneChannel( channel, radiansPerSample );
+        const auto phasor = std::polar( 1.0, phi );
+        phasorRe[ channel ] = phasor.real();
+        phasorIm[ channel ] = phasor.imag();
+        sampleCounters[ channel ] = 0;
+    }
+
+    size_t getSampleCount( size_t channel ) const { return sampleCounters[ checked( channel ) ]; }
+
+    FlyingPhasorElementType peekNextSample( size_t channel ) const
+    {
+        return FlyingPhasorElementType{ phasorRe[ checked( channel ) ], phasorIm[ channel ] };
+    }
+
+private:
+    size_t checked( size_t channel ) const
+    {
+        if ( getChannelCount() <= channel )
+            throw std::invalid_argument{ "FlyingPhasorMultiChannelGenerator: channel out of range" };
+        return channel;
+    }
+
+    template< typename Output >
+    void generateKernel( const Output & output, size_t numSamples, bool accumulate )
+    {
+        const auto op = accumulate ? Detail::FlyingPhasorKernelOp::Accum : Detail::FlyingPhasorKernelOp::Get;
+        const size_t numChannels = getChannelCount();
+        for ( size_t c = 0; numChannels != c; ++c )
+        {
+            const auto phasor = Detail::flyingPhasorKernel( op, FlyingPhasorElementType{ phasorRe[ c ], phasorIm[ c ] },
+                                                            FlyingPhasorElementType{ rateRe[ c ], rateIm[ c ] },
+                                                            output( c ), numSamples, 1.0, nullptr );
+            phasorRe[ c ] = phasor.real();
+            phasorIm[ c ] = phasor.imag();
+        }
+    }
+
+    template< typename Output >
+    void generateGroup( const Output & output, size_t first, size_t numChannels, size_t numSamples, bool accumulate )
+    {
+        double * const pRateRe = &rateRe[ first ];
+        double * const pRateIm = &rateIm[ first ];
+        double * const pRe = &phasorRe[ first ];
+        double * const pIm = &phasorIm[ first ];
+
+        // Whether each channel normalizes after its even and odd numbered samples of this request.
+        // See FlyingPhasorToneGenerator::normalize, which normalizes after odd numbered samples of its life.
+        double * const pOddEven = &oddEven[ first ];
+        double * const pOddOdd = &oddOdd[ first ];
+        for ( size_t c = 0; numChannels != c; ++c )
+        {
+            pOddEven[ c ] = ( sampleCounters[ first + c ] & 0x1 ) ? 1.0 : 0.0;
+            pOddOdd[ c ] = 1.0 - pOddEven[ c ];
+        }
+
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            // Deliver. These stores are scattered, one per channel.
+            for ( size_t c = 0; numChannels != c; ++c )
+            {
+                auto & sample = output( first + c )[ n ];
+                if ( accumulate )
+                    sample += FlyingPhasorElementType{ pRe[ c ], pIm[ c ] };
+                else
+                    sample = FlyingPhasorElementType{ pRe[ c ], pIm[ c ] };
+            }
+
+            // Advance (rotate) every phasor by its rate and, perform the normalization work. These loops
+            // touch contiguous doubles only and vectorize across channels.
+            const double * const pOdd = ( n & 0x1 ) ? pOddOdd : pOddEven;
+            for ( size_t c = 0; numChannels != c; ++c )
+            {
+                const double re = pRe[ c ] * pRateRe[ c ] - pIm[ c ] * pRateIm[ c ];
+                const double im = pRe[ c ] * pRateIm[ c ] + pIm[ c ] * pRateRe[ c ];
+                const double d = 1.0 - pOdd[ c ] * ( ( re * re + im * im - 1.0 ) / 2.0 );
+                pRe[ c ] = re * d;
+                pIm[ c ] = im * d;
+            }
+        }
+    }
+
+private:
+    // The structure of arrays. Element c of each describes channel c.
+    std::vector< double > rateRe;
+    std::vector< double > rateIm;
+    std::vector< double > phasorRe;
+    std::vector< double > phasorIm;
+    std::vector< size_t > sampleCounters;
+
+    // Scratch for the duration of a request. One where a channel normalizes, zero where it does not.
+    std::vector< double > oddEven;
+    std::vector< double > oddOdd;
+};
+
+FlyingPhasorMultiChannelGenerator::FlyingPhasorMultiChannelGenerator( size_t numChannels,
+                                                                      const double * pRadiansPerSample,
+                                                                      const double * pPhis )
+    : pImple{ nullptr }
+{
+    if ( 0 != numChannels && nullptr == pRadiansPerSample )
+        throw std::invalid_argument{ "FlyingPhasorMultiChannelGenerator: rates are required for every channel" };
+
+    pImple = new Imple{ numChannels, pRadiansPerSample, pPhis };
+}
+
+FlyingPhasorMultiChannelGenerator::~FlyingPhasorMultiChannelGenerator()
+{
+    delete pImple;
+}
+
+size_t FlyingPhasorMultiChannelGenerator::getChannelCount() const
+{
+    return pImple->getChannelCount();
+}
+
+void FlyingPhasorMultiChannelGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( ChannelMajor{ pElementBuffer, numSamples }, numSamples, false );
+}
+
+void FlyingPhasorMultiChannelGenerator::getSamples( const FlyingPhasorElementBufferTypePtr * ppElementBuffers,
+                                                    size_t numSamples )
+{
+    pImple->generate( PerChannel{ ppElementBuffers }, numSamples, false );
+}
+
+void FlyingPhasorMultiChannelGenerator::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( ChannelMajor{ pElementBuffer, numSamples }, numSamples, true );
+}
+
+void FlyingPhasorMultiChannelGenerator::accumSamples( const FlyingPhasorElementBufferTypePtr * ppElementBuffers,
+                                                      size_t numSamples )
+{
+    pImple->generate( PerChannel{ ppElementBuffers }, numSamples, true );
+}
+
+void FlyingPhasorMultiChannelGenerator::retuneChannel( size_t channel, double radiansPerSample )
+{
+    pImple->retuneChannel( channel, radiansPerSample );
+}
+
+void FlyingPhasorMultiChannelGenerator::resetChannel( size_t channel, double radiansPerSample, double phi )
+{
+    pImple->resetChannel( channel, radiansPerSample, phi );
+}
+
+size_t FlyingPhasorMultiChannelGenerator::getSampleCount( size_t channel ) const
+{
+    return pImple->getSampleCount( channel );
+}
+
+FlyingPhasorElementType FlyingPhasorMultiChannelGenerator::peekNextSample( size_t channel ) const
+{
+    return pImple->peekNextSample( channel );
+}
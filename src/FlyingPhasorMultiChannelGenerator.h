@@ -0,0 +1,190 @@
+/**
+ * @file FlyingPhasorMultiChannelGenerator.h
+ * @brief The Specification file for the Flying Phasor Multi-Channel Generator
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORMULTICHANNELGENERATOR_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORMULTICHANNELGENERATOR_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorMultiChannelGenerator
+         *
+         * Running thousands of independent channels, each with its own FlyingPhasorToneGenerator and its own
+         * getSamples invocation, is dominated by per invocation overhead and scattered state when blocks are
+         * short. FlyingPhasorMultiChannelGenerator keeps the rates, phasors and sample counters of all of its
+         * channels in contiguous arrays (structure of arrays) and delivers a block of samples for every
+         * channel in a single invocation. For short blocks, the recurrence is stepped for all channels at
+         * once, one sample at a time, which the compiler vectorizes across channels rather than across time.
+         * Longer blocks are handed to the multi-lane kernels, channel by channel.
+         *
+         * Each channel delivers, bit for bit, what a FlyingPhasorToneGenerator constructed with the same
+         * parameters would, given the same sequence of request sizes.
+         *
+         * Output is either channel major, with channel c's samples at c * numSamples in a single buffer, or
+         * into one user provided buffer per channel.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorMultiChannelGenerator
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The structure of arrays is hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Construct a Flying Phasor Multi-Channel Generator Instance
+             *
+             * Each channel starts out just as a FlyingPhasorToneGenerator constructed with the same
+             * radiansPerSample and phi would.
+             *
+             * @param numChannels The number of channels.
+             * @param pRadiansPerSample A vector of numChannels rates, in radians per sample.
+             * @param pPhis A vector of numChannels initial phases in radians. If null, all phases start at zero.
+             *
+             * @throw Throws std::invalid_argument if pRadiansPerSample is null while numChannels is not zero.
+             */
+            FlyingPhasorMultiChannelGenerator( size_t numChannels, const double * pRadiansPerSample,
+                                               const double * pPhis=nullptr );
+
+            /**
+             * @brief Destruct a Flying Phasor Multi-Channel Generator Instance
+             *
+             * This operation releases the implementation.
+             */
+            ~FlyingPhasorMultiChannelGenerator();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorMultiChannelGenerator( const FlyingPhasorMultiChannelGenerator & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorMultiChannelGenerator & operator=( const FlyingPhasorMultiChannelGenerator & ) = delete;
+
+            /**
+             * @brief Get Channel Count
+             *
+             * @return Returns the number of channels.
+             */
+            size_t getChannelCount() const;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples for every channel into a single user provided buffer,
+             * channel major. Channel c's samples begin at pElementBuffer + c * numSamples.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold numChannels * numSamples samples.
+             * @param numSamples The number of samples to be delivered per channel.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples for every channel into a user provided buffer per channel.
+             *
+             * @param ppElementBuffers A vector of numChannels user provided buffers, each large enough to hold
+             * the requested number of samples.
+             * @param numSamples The number of samples to be delivered per channel.
+             */
+            void getSamples( const FlyingPhasorElementBufferTypePtr * ppElementBuffers, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number samples for every channel into a single user provided buffer,
+             * channel major. Channel c's samples begin at pElementBuffer + c * numSamples.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold numChannels * numSamples samples.
+             * @param numSamples The number of samples to be accumulated per channel.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number samples for every channel into a user provided buffer
+             * per channel.
+             *
+             * @param ppElementBuffers A vector of numChannels user provided buffers, each large enough to hold
+             * the requested number of samples.
+             * @param numSamples The number of samples to be accumulated per channel.
+             */
+            void accumSamples( const FlyingPhasorElementBufferTypePtr * ppElementBuffers, size_t numSamples );
+
+            /**
+             * @brief Retune Channel Operation
+             *
+             * This operation changes the frequency of a channel. The channel's phase picks up right where it
+             * left off (i.e., the change is phase continuous).
+             *
+             * @param channel The channel to be retuned.
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             *
+             * @throw Throws std::invalid_argument if channel is out of range.
+             */
+            void retuneChannel( size_t channel, double radiansPerSample );
+
+            /**
+             * @brief Reset Channel Operation
+             *
+             * This operation resets a channel just as FlyingPhasorToneGenerator::reset would.
+             *
+             * @param channel The channel to be reset.
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the channel in radians.
+             *
+             * @throw Throws std::invalid_argument if channel is out of range.
+             */
+            void resetChannel( size_t channel, double radiansPerSample, double phi=0.0 );
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @param channel The channel of interest.
+             *
+             * @return Returns the number of samples delivered for the channel since construction or its last reset.
+             *
+             * @throw Throws std::invalid_argument if channel is out of range.
+             */
+            size_t getSampleCount( size_t channel ) const;
+
+            /**
+             * @brief Peek Next Sample
+             *
+             * @param channel The channel of interest.
+             *
+             * @return Returns the sample the channel will deliver next, without advancing it.
+             *
+             * @throw Throws std::invalid_argument if channel is out of range.
+             */
+            FlyingPhasorElementType peekNextSample( size_t channel ) const;
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORMULTICHANNELGENERATOR_H
@@ -0,0 +1,66 @@
+/**
+ * @file FlyingPhasorNormalizationPolicies.h
+ * @brief The Specification file for the Flying Phasor Normalization Policies
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORNORMALIZATIONPOLICIES_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORNORMALIZATIONPOLICIES_H
+
+#include <cmath>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief First Order Taylor Normalization Policy
+         *
+         * Scales the phasor by a first order Taylor Series approximation of 1/sqrt around 1, as
+         * FlyingPhasorToneGenerator does. One multiply and one add. This is also exactly one Newton-Raphson
+         * iteration for 1/sqrt seeded with 1. Its residual is 3/8 of the square of the magnitude squared error,
+         * well below an ULP for the ULP sized errors that a few rotations accumulate.
+         */
+        struct FirstOrderTaylorNormalization
+        {
+            static inline double correction( double magnitudeSquared )
+            {
+                return 1.0 - ( magnitudeSquared - 1.0 ) / 2.0;
+            }
+        };
+
+        /**
+         * @brief Second Order Taylor Normalization Policy
+         *
+         * Adds the second order term, 3/8 * e^2, to the first order correction. Its residual is cubic in the
+         * error. This only matters where the error grows well beyond an ULP between normalizations,
+         * with very long normalization periods for instance.
+         */
+        struct SecondOrderTaylorNormalization
+        {
+            static inline double correction( double magnitudeSquared )
+            {
+                const double e = magnitudeSquared - 1.0;
+                return 1.0 - e * ( 0.5 - 0.375 * e );
+            }
+        };
+
+        /**
+         * @brief Exact Normalization Policy
+         *
+         * Divides by the square root of the magnitude squared. A correctly rounded reference, at the cost of
+         * a square root and a divide.
+         */
+        struct ExactNormalization
+        {
+            static inline double correction( double magnitudeSquared )
+            {
+                return 1.0 / std::sqrt( magnitudeSquared );
+            }
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORNORMALIZATIONPOLICIES_H
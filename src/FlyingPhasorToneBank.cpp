@@ -0,0 +1,273 @@
+/**
+ * @file FlyingPhasorToneBank.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Bank
+ *
+ * The bank reproduces, tone for tone, exactly what FlyingPhasorToneGenerator does. Small requests run the
+ * serial recurrence, here for every tone at once, sample by sample. Larger requests run the multi-lane kernels
+ * one tile of output at a time, every tone in turn, so the tile stays in cache while it is being summed.
+ * The lane seeds depend only upon a tone's rate and so, are computed when a tone is added or retuned rather
+ * than on every request as the per instance path must.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneBank.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Samples per tile for the kernel path. 1024 samples is 16KB, which sits comfortably in the L1 data cache
+    // of most anything current. It must be a whole number of kernel blocks.
+    constexpr size_t tileSize = 1024;
+    static_assert( 0 == tileSize % Detail::flyingPhasorLaneCount, "tileSize must be a multiple of the lane count" );
+}
+
+class FlyingPhasorToneBank::Imple
+{
+public:
+    Imple() = default;
+    ~Imple() = default;
+
+    ToneId addTone( double radiansPerSample, double phi, double magnitude )
+    {
+        ids.push_back( nextId );
+        rates.push_back( std::polar( 1.0, radiansPerSample ) );
+        phasors.push_back( std::polar( 1.0, phi ) );
+        magnitudes.push_back( magnitude );
+        sampleCounters.push_back( 0 );
+        seeds.emplace_back();
+        Detail::flyingPhasorSeedLanes( rates.back(), seeds.back() );
+        masters.emplace_back( phasors.back() );
+        return nextId++;
+    }
+
+    void removeTone( ToneId toneId )
+    {
+        const auto i = indexOf( toneId );
+        ids.erase( ids.begin() + i );
+        rates.erase( rates.begin() + i );
+        phasors.erase( phasors.begin() + i );
+        magnitudes.erase( magnitudes.begin() + i );
+        sampleCounters.erase( sampleCounters.begin() + i );
+        seeds.erase( seeds.begin() + i );
+        masters.erase( masters.begin() + i );
+    }
+
+    void retuneTone( ToneId toneId, double radiansPerSample )
+    {
+        const auto i = indexOf( toneId );
+        rates[ i ] = std::polar( 1.0, radiansPerSample );
+        Detail::flyingPhasorSeedLanes( rates[ i ], seeds[ i ] );
+    }
+
+    void setToneMagnitude( ToneId toneId, double magnitude )
+    {
+        magnitudes[ indexOf( toneId ) ] = magnitude;
+    }
+
+    size_t getToneCount() const { return ids.size(); }
+
+    void generate( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        sampleCounter += numSamples;
+        if ( ids.empty() )
+        {
+            if ( !accumulate )
+                std::fill( pElementBuffer, pElementBuffer + numSamples, FlyingPhasorElementType{} );
+            return;
+        }
+
+        if ( Detail::flyingPhasorUseKernel( numSamples ) )
+            generateTiled( pElementBuffer, numSamples, accumulate );
+        else
+            generateSerial( pElementBuffer, numSamples, accumulate );
+    }
+
+    // Sum a chunk at a time in double precision and convert each chunk, so the sum is rounded only once.
+    template< typename T >
+    void generateFixedPoint( T * pIQBuffer, size_t numSamples, double fullScaleGain, bool accumulate, bool dither )
+    {
+        // See FlyingPhasorToneGenerator::getSamplesSC16. A gain that is not finite has no integers to deliver.
+        const double gain = fullScaleGain * std::numeric_limits< T >::max();
+        if ( !std::isfinite( gain ) )
+            throw std::invalid_argument{ "FlyingPhasorToneBank: fullScaleGain must be finite" };
+
+        uint64_t ditherState = Detail::flyingPhasorDitherSeed( sampleCounter, ids.empty() ? unitRate : rates[ 0 ] );
+
+        FlyingPhasorElementType chunk[ Detail::flyingPhasorScratchChunkSize ];
+        while ( numSamples )
+        {
+            const size_t n = std::min( numSamples, Detail::flyingPhasorScratchChunkSize );
+            generate( chunk, n, false );
+            Detail::flyingPhasorConvertFixedPoint( chunk, pIQBuffer, n, gain, accumulate,
+                                                   dither ? &ditherState : nullptr );
+            pIQBuffer += 2 * n;
+            numSamples -= n;
+        }
+    }
+
+private:
+    size_t indexOf( ToneId toneId ) const
+    {
+        const auto iter = std::find( ids.begin(), ids.end(), toneId );
+        if ( ids.end() == iter )
+            throw std::invalid_argument{ "FlyingPhasorToneBank: Unknown ToneId" };
+        return size_t( iter - ids.begin() );
+    }
+
+    void generateSerial( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        const size_t numTones = ids.size();
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            // Sum every tone into this one sample in the order the tones were added,
+            // exactly as successive accumSamplesScaled invocations would.
+            auto sum = accumulate ? pElementBuffer[ i ] + phasors[ 0 ] * magnitudes[ 0 ] : phasors[ 0 ] * magnitudes[ 0 ];
+            for ( size_t t = 1; numTones != t; ++t )
+                sum += phasors[ t ] * magnitudes[ t ];
+            pElementBuffer[ i ] = sum;
+
+            // Now advance (rotate) every phasor by its rate and, perform the normalization work.
+            // See FlyingPhasorToneGenerator::normalize.
+            for ( size_t t = 0; numTones != t; ++t )
+            {
+                phasors[ t ] *= rates[ t ];
+                if ( ( sampleCounters[ t ]++ & 0x1 ) == 0x1 )
+                {
+                    const double d = 1.0 - ( phasors[ t ].real() * phasors[ t ].real() +
+                                             phasors[ t ].imag() * phasors[ t ].imag() - 1.0 ) / 2.0;
+                    phasors[ t ] *= d;
+                }
+            }
+        }
+    }
+
+    void generateTiled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        const size_t numTones = ids.size();
+        for ( size_t t = 0; numTones != t; ++t )
+            masters[ t ] = Detail::FlyingPhasorMaster{ phasors[ t ] };
+
+        const auto firstOp = accumulate ? Detail::FlyingPhasorKernelOp::AccumScaled :
+                                          Detail::FlyingPhasorKernelOp::GetScaled;
+        constexpr auto restOp = Detail::FlyingPhasorKernelOp::AccumScaled;
+
+        // Whole blocks, one tile at a time, every tone in turn.
+        const size_t numBlocks = numSamples / Detail::flyingPhasorLaneCount;
+        constexpr size_t blocksPerTile = tileSize / Detail::flyingPhasorLaneCount;
+        for ( size_t b = 0; numBlocks > b; b += blocksPerTile )
+        {
+            const size_t tileBlocks = std::min( blocksPerTile, numBlocks - b );
+            const auto pTile = pElementBuffer + b * Detail::flyingPhasorLaneCount;
+            for ( size_t t = 0; numTones != t; ++t )
+                Detail::flyingPhasorKernelBlocks( 0 == t ? firstOp : restOp, seeds[ t ], masters[ t ],
+                                                  pTile, tileBlocks, magnitudes[ t ], nullptr );
+        }
+
+        // Then, whatever partial block remains.
+        const size_t done = numBlocks * Detail::flyingPhasorLaneCount;
+        for ( size_t t = 0; numTones != t; ++t )
+        {
+            phasors[ t ] = Detail::flyingPhasorKernelTail( 0 == t ? firstOp : restOp, seeds[ t ], masters[ t ],
+                                                           pElementBuffer + done, numSamples - done,
+                                                           magnitudes[ t ], nullptr );
+            sampleCounters[ t ] += numSamples;
+        }
+    }
+
+private:
+    ToneId nextId{};
+
+    // Samples delivered by the bank as a whole. Together with the first tone's rate, it seeds the dither.
+    size_t sampleCounter{};
+    const FlyingPhasorElementType unitRate{ 1.0, 0.0 };
+
+    // The structure of arrays. Element t of each describes tone t.
+    std::vector< ToneId > ids{};
+    std::vector< FlyingPhasorElementType > rates{};
+    std::vector< FlyingPhasorElementType > phasors{};
+    std::vector< double > magnitudes{};
+    std::vector< size_t > sampleCounters{};
+
+    // Kernel state. Seeds persist with the rate. Masters are scratch for the duration of a request.
+    std::vector< Detail::FlyingPhasorLaneSeeds > seeds{};
+    std::vector< Detail::FlyingPhasorMaster > masters{};
+};
+
+FlyingPhasorToneBank::FlyingPhasorToneBank()
+    : pImple{ new Imple{} }
+{
+}
+
+FlyingPhasorToneBank::~FlyingPhasorToneBank()
+{
+    delete pImple;
+}
+
+FlyingPhasorToneBank::ToneId FlyingPhasorToneBank::addTone( double radiansPerSample, double phi, double magnitude )
+{
+    return pImple->addTone( radiansPerSample, phi, magnitude );
+}
+
+void FlyingPhasorToneBank::removeTone( ToneId toneId )
+{
+    pImple->removeTone( toneId );
+}
+
+void FlyingPhasorToneBank::retuneTone( ToneId toneId, double radiansPerSample )
+{
+    pImple->retuneTone( toneId, radiansPerSample );
+}
+
+void FlyingPhasorToneBank::setToneMagnitude( ToneId toneId, double magnitude )
+{
+    pImple->setToneMagnitude( toneId, magnitude );
+}
+
+size_t FlyingPhasorToneBank::getToneCount() const
+{
+    return pImple->getToneCount();
+}
+
+void FlyingPhasorToneBank::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( pElementBuffer, numSamples, false );
+}
+
+void FlyingPhasorToneBank::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->generate( pElementBuffer, numSamples, true );
+}
+
+void FlyingPhasorToneBank::getSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                           double fullScaleGain, bool dither )
+{
+    pImple->generateFixedPoint( pIQBuffer, numSamples, fullScaleGain, false, dither );
+}
+
+void FlyingPhasorToneBank::accumSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                             double fullScaleGain, bool dither )
+{
+    pImple->generateFixedPoint( pIQBuffer, numSamples, fullScaleGain, true, dither );
+}
+
+void FlyingPhasorToneBank::getSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                          double fullScaleGain, bool dither )
+{
+    pImple->generateFixedPoint( pIQBuffer, numSamples, fullScaleGain, false, dither );
+}
+
+void FlyingPhasorToneBank::accumSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                            double fullScaleGain, bool dither )
+{
+    pImple->generateFixedPoint( pIQBuffer, numSamples, fullScaleGain, true, dither );
+}
@@ -0,0 +1,236 @@
+/**
+ * @file FlyingPhasorToneBank.h
+ * @brief The Specification file for the Flying Phasor Tone Bank
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORTONEBANK_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORTONEBANK_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorToneBank
+         *
+         * Summing many tones with FlyingPhasorToneGenerator means one instance per tone, with each
+         * accumSamples invocation making a full pass over the output buffer. With hundreds of tones, that is
+         * bound by memory bandwidth rather than by arithmetic. FlyingPhasorToneBank keeps the rates, phasors and
+         * magnitudes of all of its tones in contiguous arrays (structure of arrays) and works through the output
+         * buffer in cache sized tiles, writing each output sample to memory once with all tones summed.
+         *
+         * The results are identical, bit for bit, to what you would obtain with one FlyingPhasorToneGenerator
+         * per tone, constructed with the same parameters, getting the first tone's samples with getSamplesScaled
+         * and accumulating the rest in the order they were added with accumSamplesScaled, using the same
+         * sequence of request sizes.
+         *
+         * Tones are identified by the ToneId returned when they are added. Removing a tone does not
+         * disturb the order of those that remain.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorToneBank
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation Class
+             *
+             * The structure of arrays and per tone kernel state are hidden away to keep this interface stable.
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Alias for Tone Identifier
+             *
+             * Tone identifiers are unique for the life of a bank instance. They are never reused.
+             */
+            using ToneId = size_t;
+
+            /**
+             * @brief Construct a Flying Phasor Tone Bank Instance
+             *
+             * This operation constructs an empty FlyingPhasorToneBank instance.
+             */
+            FlyingPhasorToneBank();
+
+            /**
+             * @brief Destruct a Flying Phasor Tone Bank Instance
+             *
+             * This operation releases the implementation.
+             */
+            ~FlyingPhasorToneBank();
+
+            /**
+             * @brief Copy Construction Deleted
+             */
+            FlyingPhasorToneBank( const FlyingPhasorToneBank & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            FlyingPhasorToneBank & operator=( const FlyingPhasorToneBank & ) = delete;
+
+            /**
+             * @brief Add Tone Operation
+             *
+             * This operation adds a tone to the bank. The tone starts out just as a FlyingPhasorToneGenerator
+             * constructed with the same radiansPerSample and phi would.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the tone in radians.
+             * @param magnitude The scalar to be multiplied against each sample of the tone.
+             *
+             * @return Returns the identifier of the tone added.
+             */
+            ToneId addTone( double radiansPerSample, double phi=0.0, double magnitude=1.0 );
+
+            /**
+             * @brief Remove Tone Operation
+             *
+             * This operation removes a tone from the bank.
+             *
+             * @param toneId The identifier of the tone to be removed.
+             *
+             * @throw Throws std::invalid_argument if toneId does not identify a tone in the bank.
+             */
+            void removeTone( ToneId toneId );
+
+            /**
+             * @brief Retune Tone Operation
+             *
+             * This operation changes the frequency of a tone. The tone's phase picks up right where it
+             * left off (i.e., the change is phase continuous).
+             *
+             * @param toneId The identifier of the tone to be retuned.
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             *
+             * @throw Throws std::invalid_argument if toneId does not identify a tone in the bank.
+             */
+            void retuneTone( ToneId toneId, double radiansPerSample );
+
+            /**
+             * @brief Set Tone Magnitude Operation
+             *
+             * This operation changes the magnitude of a tone.
+             *
+             * @param toneId The identifier of the tone.
+             * @param magnitude The scalar to be multiplied against each sample of the tone.
+             *
+             * @throw Throws std::invalid_argument if toneId does not identify a tone in the bank.
+             */
+            void setToneMagnitude( ToneId toneId, double magnitude );
+
+            /**
+             * @brief Get Tone Count
+             *
+             * This operation returns the number of tones in the bank.
+             *
+             * @return Returns the number of tones in the bank.
+             */
+            size_t getToneCount() const;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples, the sum of all tones in the bank, into the user
+             * provided buffer. An empty bank delivers zeros.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number samples, the sum of all tones in the bank, into the user
+             * provided buffer.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples SC16 Operation
+             *
+             * This operation delivers 'N' number samples, the sum of all tones in the bank, into the user provided
+             * buffer as interleaved 16 bit signed integer I/Q pairs. The tones are summed in double precision, a
+             * chunk at a time, and the sum scaled by the full scale gain, optionally dithered, rounded once
+             * and saturated, just as FlyingPhasorToneGenerator::getSamplesSC16 does for a single tone.
+             * No intermediate buffer of complex samples is required of the user.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be delivered.
+             * @param fullScaleGain The fraction of integer full scale (32767) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void getSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                 double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Accumulate Samples SC16 Operation
+             *
+             * This operation accumulates 'N' number samples, the sum of all tones in the bank, into the user
+             * provided buffer of interleaved 16 bit signed integer I/Q pairs. The scaled sum is added to what the
+             * buffer holds before rounding and saturating.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be accumulated.
+             * @param fullScaleGain The fraction of integer full scale (32767) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void accumSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                   double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Get Samples SC8 Operation
+             *
+             * This operation is the 8 bit counterpart of getSamplesSC16. Integer full scale is 127.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be delivered.
+             * @param fullScaleGain The fraction of integer full scale (127) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void getSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Accumulate Samples SC8 Operation
+             *
+             * This operation is the 8 bit counterpart of accumSamplesSC16. Integer full scale is 127.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be accumulated.
+             * @param fullScaleGain The fraction of integer full scale (127) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void accumSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                  double fullScaleGain, bool dither=false );
+
+        private:
+            /**
+             * @brief Pointer to Implementation
+             */
+            Imple * pImple;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORTONEBANK_H
@@ -8,9 +8,82 @@
 
 
 #include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <cmath>
 
 using namespace ReiserRT::Signal;
 
+namespace
+{
+    // An unevaluated sum, hi + lo, carrying about twice the precision of a double. Products are made exact with
+    // std::fma, as FlyingPhasorExactToneGenerator forms its sample phase, so nothing here depends upon long double
+    // being any wider than double (it is not, with MSVC).
+    struct DoubleDouble
+    {
+        double hi;
+        double lo;
+    };
+
+    inline DoubleDouble quickTwoSum( double a, double b )
+    {
+        const double s = a + b;
+        return { s, b - ( s - a ) };
+    }
+
+    inline DoubleDouble operator+( const DoubleDouble & a, const DoubleDouble & b )
+    {
+        const double s = a.hi + b.hi;
+        const double bb = s - a.hi;
+        const double e = ( a.hi - ( s - bb ) ) + ( b.hi - bb );
+        return quickTwoSum( s, e + a.lo + b.lo );
+    }
+
+    inline DoubleDouble operator-( const DoubleDouble & a, const DoubleDouble & b )
+    {
+        return a + DoubleDouble{ -b.hi, -b.lo };
+    }
+
+    inline DoubleDouble operator*( const DoubleDouble & a, const DoubleDouble & b )
+    {
+        const double p = a.hi * b.hi;
+        return quickTwoSum( p, std::fma( a.hi, b.hi, -p ) + ( a.hi * b.lo + a.lo * b.hi ) );
+    }
+
+    struct DoubleDoubleComplex
+    {
+        DoubleDouble re;
+        DoubleDouble im;
+    };
+
+    // The product, pulled back to unit magnitude. Both factors are within an ULP or so of unit magnitude and so,
+    // one Newton step toward the reciprocal square root, (3 - m^2) / 2, does so to double-double precision.
+    // Scaling by a real leaves the angle alone.
+    inline DoubleDoubleComplex unitProduct( const DoubleDoubleComplex & a, const DoubleDoubleComplex & b )
+    {
+        const DoubleDoubleComplex p{ a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+        const DoubleDouble k = DoubleDouble{ 1.5, 0.0 } - DoubleDouble{ 0.5, 0.0 } * ( p.re * p.re + p.im * p.im );
+        return { p.re * k, p.im * k };
+    }
+
+    // rate^n, or its conjugate, by repeated squaring. Each squaring doubles the angle exactly, but for a
+    // rounding in the order of 1e-32 and so, the angle of the result is n times that of the rate to within
+    // n * 1e-32 radians or so.
+    DoubleDoubleComplex unitPower( const FlyingPhasorElementType & rate, size_t n, bool conjugate )
+    {
+        DoubleDoubleComplex result{ { 1.0, 0.0 }, { 0.0, 0.0 } };
+        DoubleDoubleComplex base{ { rate.real(), 0.0 }, { conjugate ? -rate.imag() : rate.imag(), 0.0 } };
+        for ( ; 0 != n; n >>= 1 )
+        {
+            if ( 0x1 & n )
+                result = unitProduct( result, base );
+            if ( 1 != n )
+                base = unitProduct( base, base );
+        }
+        return result;
+    }
+}
+
 FlyingPhasorToneGenerator::FlyingPhasorToneGenerator( double radiansPerSample, double phi )
     : rate{ std::polar( 1.0, radiansPerSample ) }
     , phasor{ std::polar( 1.0, phi ) }
@@ -20,6 +93,19 @@ FlyingPhasorToneGenerator::FlyingPhasorToneGenerator( double radiansPerSample, d
 
 void FlyingPhasorToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
 {
+    instrument( InstrumentedOperation::Get, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels which break up the serial dependency
+    // of one sample upon the previous. See FlyingPhasorToneGeneratorKernels.cpp for details.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::Get, phasor, rate,
+                                             pElementBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -38,6 +124,18 @@ void FlyingPhasorToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pEl
 void FlyingPhasorToneGenerator::getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
         double scalar )
 {
+    instrument( InstrumentedOperation::GetScaled, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::GetScaled, phasor, rate,
+                                             pElementBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -56,6 +154,18 @@ void FlyingPhasorToneGenerator::getSamplesScaled( FlyingPhasorElementBufferTypeP
 void FlyingPhasorToneGenerator::getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
         const double * pScalars )
 {
+    instrument( InstrumentedOperation::GetEnveloped, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::GetEnveloped, phasor, rate,
+                                             pElementBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -73,6 +183,18 @@ void FlyingPhasorToneGenerator::getSamplesScaled( FlyingPhasorElementBufferTypeP
 
 void FlyingPhasorToneGenerator::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
 {
+    instrument( InstrumentedOperation::Accum, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::Accum, phasor, rate,
+                                             pElementBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -91,6 +213,18 @@ void FlyingPhasorToneGenerator::accumSamples( FlyingPhasorElementBufferTypePtr p
 void FlyingPhasorToneGenerator::accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
                    double scalar )
 {
+    instrument( InstrumentedOperation::AccumScaled, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::AccumScaled, phasor, rate,
+                                             pElementBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -109,6 +243,18 @@ void FlyingPhasorToneGenerator::accumSamplesScaled( FlyingPhasorElementBufferTyp
 void FlyingPhasorToneGenerator::accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
                    const double * pScalars )
 {
+    instrument( InstrumentedOperation::AccumEnveloped, numSamples );
+
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorKernel( Detail::FlyingPhasorKernelOp::AccumEnveloped, phasor, rate,
+                                             pElementBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
     for ( size_t i = 0; numSamples != i; ++i )
     {
         // We always start with the current phasor to nail the very first sample (s0)
@@ -131,8 +277,31 @@ void FlyingPhasorToneGenerator::reset( double radiansPerSample, double phi )
     sampleCounter = 0;
 }
 
+void FlyingPhasorToneGenerator::skipSamples( size_t numSamples )
+{
+    seek( sampleCounter + numSamples );
+}
+
+void FlyingPhasorToneGenerator::seek( size_t sampleIndex )
+{
+    // The jump is rate^delta where delta may be negative, in which case it is the conjugate of rate^-delta.
+    // The rate as rounded when constructed is what the phasor actually advances by (the serial path normalizes
+    // away any magnitude error and the kernels use only the angle). Powers of it are formed in double-double
+    // arithmetic, whose precision does not depend upon the platform, so that the jump's angle holds to far
+    // better than a double's ULP even for jumps of billions of samples. The phasor is rotated likewise and,
+    // rounded to double once.
+    const bool forward = sampleIndex >= sampleCounter;
+    const auto jump = unitPower( rate, forward ? sampleIndex - sampleCounter : sampleCounter - sampleIndex, !forward );
+    const DoubleDouble re = DoubleDouble{ phasor.real(), 0.0 } * jump.re - DoubleDouble{ phasor.imag(), 0.0 } * jump.im;
+    const DoubleDouble im = DoubleDouble{ phasor.real(), 0.0 } * jump.im + DoubleDouble{ phasor.imag(), 0.0 } * jump.re;
+    phasor = FlyingPhasorElementType{ re.hi, im.hi };
+    sampleCounter = sampleIndex;
+}
+
 FlyingPhasorElementType FlyingPhasorToneGenerator::getSample()
 {
+    instrument( InstrumentedOperation::Single, 1 );
+
     // We always start with the current phasor to nail the very first sample (s0)
     // and advance (rotate) afterward.
     auto retValue = phasor;
@@ -146,3 +315,24 @@ FlyingPhasorElementType FlyingPhasorToneGenerator::getSample()
 
     return retValue;
 }
+
+FlyingPhasorToneGenerator::Instrumentation FlyingPhasorToneGenerator::getInstrumentation() const
+{
+#ifdef REISER_RT_FLYING_PHASOR_INSTRUMENTATION
+    return instrumentation;
+#else
+    return Instrumentation{};
+#endif
+}
+
+void FlyingPhasorToneGenerator::resetInstrumentation()
+{
+#ifdef REISER_RT_FLYING_PHASOR_INSTRUMENTATION
+    instrumentation = Instrumentation{};
+#endif
+}
+
+const char * FlyingPhasorToneGenerator::getKernelName()
+{
+    return Detail::flyingPhasorKernelName();
+}
@@ -10,6 +10,7 @@
 #define REISER_RT_FLYING_PHASOR_H
 
 #include "ReiserRT_FlyingPhasorExport.h"
+#include "ReiserRT_FlyingPhasorBuildConfig.h"
 #include "FlyingPhasorToneGeneratorDataTypes.h"
 
 namespace ReiserRT
@@ -45,6 +46,58 @@ namespace ReiserRT
         class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorToneGenerator
         {
         public:
+            /**
+             * @brief Event Type
+             *
+             * Identifies what an Event does to the tone. Frequency sets a new rate in radians per sample without
+             * disturbing phase (phase continuous). Phase sets the phase of the next sample in radians.
+             * PhaseShift advances (or retards) the phase of the next sample by some radians. Magnitude sets
+             * the magnitude of the next and subsequent samples.
+             */
+            enum class EventType : int
+            {
+                Frequency=0, Phase, PhaseShift, Magnitude
+            };
+
+            /**
+             * @brief Timeline Event
+             *
+             * An event takes effect at the sample index given, relative to the first sample delivered
+             * by the invocation it is passed to. That is, the sample at that index is the first to be affected.
+             */
+            struct Event
+            {
+                size_t sampleIndex;     //!< The index of the first sample affected.
+                EventType type;         //!< What the event does.
+                double value;           //!< Radians per sample, radians or magnitude according to type.
+            };
+
+            /**
+             * @brief Instrumented Operation
+             *
+             * Identifies how samples were delivered, for instrumentation. Every operation delivers its samples
+             * by way of one of these. Split plane, real only and streaming variants count as the operation
+             * they parallel. Fixed point, mixing, modulation, event timeline and parallel operations count as
+             * the operations they are built upon (mostly Get). Single is getSample.
+             */
+            enum class InstrumentedOperation : int
+            {
+                Get=0, GetScaled, GetEnveloped, Accum, AccumScaled, AccumEnveloped, Single, Count
+            };
+
+            /**
+             * @brief Instrumentation Snapshot
+             *
+             * The counters kept by an instance when the library is built with
+             * REISER_RT_FLYING_PHASOR_INSTRUMENTATION. Otherwise, every field is zero.
+             */
+            struct Instrumentation
+            {
+                size_t samples[ int( InstrumentedOperation::Count ) ];  //!< Samples delivered, by operation.
+                size_t renormalizations;    //!< Renormalizations performed, serially and by the kernels.
+                double worstMagnitudeError; //!< Largest magnitude error seen by a serial renormalization.
+            };
+
             /**
              * @brief Construct a Flying Phasor Instance
              *
@@ -73,6 +126,43 @@ namespace ReiserRT
              */
             void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
 
+            /**
+             * @brief Get Samples Parallel Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer,
+             * as getSamples does, using several threads. The buffer is divided into one contiguous segment per
+             * thread. Each segment is seeded with the phasor for its starting index (see skipSamples) and
+             * generated concurrently. The invoking thread generates the first segment itself. Segments meet with
+             * the purity of a serial run. This is meant for very large buffers. Requests too small to benefit
+             * use fewer threads, or just the invoking thread.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param numThreads The number of threads to use, including the invoking thread.
+             * Zero selects std::thread::hardware_concurrency.
+             */
+            void getSamplesParallel( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     unsigned int numThreads=0 );
+
+            /**
+             * @brief Get Samples Streaming Operation
+             *
+             * This operation delivers exactly the samples getSamples would, using non-temporal (streaming) stores
+             * that bypass the cache. For buffers far larger than the last level cache, that avoids reading each
+             * cache line in before overwriting it and, leaves whatever else was in the cache alone. For buffers
+             * that fit in cache, it is slower than getSamples, and the samples are not in cache afterwards.
+             * The sundry 'streamingCrossover' utility measures where it starts to pay off.
+             *
+             * The buffer need only be aligned to a whole sample (16 bytes). Samples at either end that do not fill
+             * an aligned store, and any partial block of samples at the end, are stored normally. Where the selected
+             * kernel has no non-temporal stores (the portable kernel), or the buffer is not aligned to a whole
+             * sample, this is no different from getSamples.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamplesStreaming( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
             /**
              * @brief Get Samples Scaled Operation
              *
@@ -136,6 +226,369 @@ namespace ReiserRT
             void accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
                                const double * pScalars );
 
+            /**
+             * @brief Get Samples Split Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into a pair of user provided
+             * buffers, real (I) components into one and imaginary (Q) components into the other. This is the layout
+             * many FFT and filter implementations want. The samples are unscaled (i.e., a magnitude of one) and
+             * are exactly those getSamples would have delivered.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamplesSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                  size_t numSamples );
+
+            /**
+             * @brief Get Samples Scaled Split Operation
+             *
+             * This operation is the split plane counterpart of getSamplesScaled.
+             * The samples are scaled by user provided scalar.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be multiplied against each sample.
+             */
+            void getSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                        size_t numSamples, double scalar );
+
+            /**
+             * @brief Get Samples Scaled Split Operation
+             *
+             * This operation is the split plane counterpart of getSamplesScaled.
+             * The samples are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be delivered.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void getSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                        size_t numSamples, const double * pScalars );
+
+            /**
+             * @brief Accumulate Samples Split Operation
+             *
+             * This operation is the split plane counterpart of accumSamples.
+             * The samples accumulated are unscaled (i.e., a magnitude of one).
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamplesSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                    size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Scaled Split Operation
+             *
+             * This operation is the split plane counterpart of accumSamplesScaled.
+             * The samples accumulated are scaled by user provided scalar.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar The scalar to be multiplied against each sample before accumulating.
+             */
+            void accumSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                          size_t numSamples, double scalar );
+
+            /**
+             * @brief Accumulate Samples Scaled Split Operation
+             *
+             * This operation is the split plane counterpart of accumSamplesScaled.
+             * The samples accumulated are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void accumSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer, FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                          size_t numSamples, const double * pScalars );
+
+            /**
+             * @brief Get Samples Real Operation
+             *
+             * This operation delivers only the real (cosine) components of 'N' number samples from the tone generator
+             * into a user provided buffer. The imaginary components are never stored and, for all but small requests,
+             * never derived. That halves both the work and the memory traffic of getSamples for consumers that want
+             * a real sinusoid.
+             * The components are exactly those getSamplesSplit would have delivered into its real buffer and,
+             * phase carries across invocations of any of the operations, as usual.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamplesReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Scaled Real Operation
+             *
+             * This operation is the real only counterpart of getSamplesScaled.
+             * The components are scaled by user provided scalar.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be multiplied against each component.
+             */
+            void getSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples, double scalar );
+
+            /**
+             * @brief Get Samples Scaled Real Operation
+             *
+             * This operation is the real only counterpart of getSamplesScaled.
+             * The components are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be delivered.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void getSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples, const double * pScalars );
+
+            /**
+             * @brief Accumulate Samples Real Operation
+             *
+             * This operation is the real only counterpart of accumSamples.
+             * The components accumulated are unscaled (i.e., an amplitude of one).
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamplesReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Scaled Real Operation
+             *
+             * This operation is the real only counterpart of accumSamplesScaled.
+             * The components accumulated are scaled by user provided scalar.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar The scalar to be multiplied against each component before accumulating.
+             */
+            void accumSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples, double scalar );
+
+            /**
+             * @brief Accumulate Samples Scaled Real Operation
+             *
+             * This operation is the real only counterpart of accumSamplesScaled.
+             * The components accumulated are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void accumSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples, const double * pScalars );
+
+            /**
+             * @brief Get Samples SC16 Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer
+             * as interleaved 16 bit signed integer I/Q pairs. Each sample is scaled by the full scale gain,
+             * optionally dithered, rounded to the nearest integer and saturated. No intermediate buffer of complex
+             * samples is required of the user.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be delivered.
+             * @param fullScaleGain The fraction of integer full scale (32767) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void getSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                 double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Accumulate Samples SC16 Operation
+             *
+             * This operation accumulates 'N' number samples from the tone generator into the user provided buffer
+             * of interleaved 16 bit signed integer I/Q pairs. The scaled sample is added to what the buffer holds
+             * before rounding and saturating, so that accumulating incurs only one rounding per invocation.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be accumulated.
+             * @param fullScaleGain The fraction of integer full scale (32767) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void accumSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                   double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Get Samples SC8 Operation
+             *
+             * This operation is the 8 bit counterpart of getSamplesSC16. Integer full scale is 127.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be delivered.
+             * @param fullScaleGain The fraction of integer full scale (127) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void getSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Accumulate Samples SC8 Operation
+             *
+             * This operation is the 8 bit counterpart of accumSamplesSC16. Integer full scale is 127.
+             *
+             * @param pIQBuffer User provided buffer large enough to hold two components per requested sample.
+             * @param numSamples The number of samples to be accumulated.
+             * @param fullScaleGain The fraction of integer full scale (127) that a unit magnitude sample maps to.
+             * @param dither If true, triangular PDF dither of plus or minus one LSB is added before rounding.
+             *
+             * @throw Throws std::invalid_argument if the full scale gain is not finite. Nothing is generated.
+             */
+            void accumSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                  double fullScaleGain, bool dither=false );
+
+            /**
+             * @brief Mix Samples Operation
+             *
+             * This operation multiplies 'N' number of user provided input samples by the tone (or its complex
+             * conjugate) and delivers the products into the user provided output buffer. It is the numerically
+             * controlled oscillator (NCO) mixer. Multiplying by the conjugate shifts the input down in frequency
+             * by the tone's rate and, by the tone itself, up. The tone picks up across invocations
+             * just as getSamples does. The tone is generated a chunk at a time into a small buffer on the stack,
+             * so no intermediate buffer is required of the user.
+             *
+             * @param pInputBuffer User provided buffer holding the requested number of input samples.
+             * @param pOutputBuffer User provided buffer large enough to hold the requested number of samples.
+             * It may be the input buffer itself.
+             * @param numSamples The number of samples to be mixed.
+             * @param conjugate If true, mix with the complex conjugate of the tone.
+             */
+            void mixSamples( const FlyingPhasorElementType * pInputBuffer, FlyingPhasorElementBufferTypePtr pOutputBuffer,
+                             size_t numSamples, bool conjugate=false );
+
+            /**
+             * @brief Mix Samples In Place Operation
+             *
+             * This operation multiplies 'N' number of user provided samples by the tone (or its complex
+             * conjugate) in place. See the out of place variant.
+             *
+             * @param pElementBuffer User provided buffer holding the requested number of samples.
+             * @param numSamples The number of samples to be mixed.
+             * @param conjugate If true, mix with the complex conjugate of the tone.
+             */
+            void mixSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool conjugate=false );
+
+            /**
+             * @brief Get Samples With Events Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer,
+             * applying a timeline of events at the sample indices specified along the way. Frequency hops, phase
+             * jumps and magnitude steps land exactly on the samples intended, without the user having to split
+             * the buffer up. Between events, samples are generated exactly as getSamplesScaled would.
+             * Unlike reset, the sample counter carries on and, frequency changes are phase continuous.
+             *
+             * Events must be sorted by sample index. Events sharing an index are applied in the order given.
+             * An event at index numSamples takes effect after the last sample delivered, that is, upon
+             * the next invocation.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param pEvents The timeline of events. May be null if numEvents is zero.
+             * @param numEvents The number of events in the timeline.
+             * @param magnitude The magnitude of samples prior to any Magnitude event.
+             *
+             * @return Returns the magnitude in effect after the last event, for use with the next invocation.
+             *
+             * @throw Throws std::invalid_argument if events are not sorted or, an index exceeds numSamples.
+             * Nothing is delivered and the instance is left unchanged.
+             */
+            double getSamplesWithEvents( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                         const Event * pEvents, size_t numEvents, double magnitude=1.0 );
+
+            /**
+             * @brief Accumulate Samples With Events Operation
+             *
+             * This operation is the accumulating counterpart of getSamplesWithEvents. Between events,
+             * samples are accumulated exactly as accumSamplesScaled would.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pEvents The timeline of events. May be null if numEvents is zero.
+             * @param numEvents The number of events in the timeline.
+             * @param magnitude The magnitude of samples prior to any Magnitude event.
+             *
+             * @return Returns the magnitude in effect after the last event, for use with the next invocation.
+             *
+             * @throw Throws std::invalid_argument if events are not sorted or, an index exceeds numSamples.
+             * Nothing is accumulated and the instance is left unchanged.
+             */
+            double accumSamplesWithEvents( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                           const Event * pEvents, size_t numEvents, double magnitude=1.0 );
+
+            /**
+             * @brief Get Samples Phase Modulated Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer,
+             * each rotated by a user provided phase offset. It is the phase counterpart of the scalar vector
+             * (magnitude envelope) form of getSamplesScaled. The offsets do not disturb the carrier, which carries
+             * on exactly as getSamples would leave it. Offsets are applied by rotating an anchor phasor with a
+             * small angle series. Trig functions are invoked only where an offset strays more than 1/4 radian
+             * from the last anchor.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param pPhases A vector of phase offsets, in radians, at least as long as the number of samples requested.
+             */
+            void getSamplesPhaseModulated( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                           const double * pPhases );
+
+            /**
+             * @brief Accumulate Samples Phase Modulated Operation
+             *
+             * This operation is the accumulating counterpart of getSamplesPhaseModulated.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pPhases A vector of phase offsets, in radians, at least as long as the number of samples requested.
+             */
+            void accumSamplesPhaseModulated( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                             const double * pPhases );
+
+            /**
+             * @brief Get Samples Frequency Modulated Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer,
+             * with the phase advancing from each sample to the next by a user provided rate, rather than the
+             * instance's own. The first sample is the current phasor, as always. Afterward, the instance carries
+             * on, phase continuous, at the last rate provided, as if it had been retuned to that rate. The
+             * sample counter advances as for getSamples. Larger requests generate a carrier by the multi-lane
+             * kernels and, rotate each sample by its phase offset from it, by a short Taylor series. Smaller ones
+             * advance by a rate phasor formed per sample, with trig functions invoked only where the rate strays
+             * more than 1/64 radian per sample from the last anchor. See the implementation file for details.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param pRadiansPerSample A vector of rates, in radians per sample, at least as long as
+             * the number of samples requested.
+             */
+            void getSamplesFrequencyModulated( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                               const double * pRadiansPerSample );
+
+            /**
+             * @brief Accumulate Samples Frequency Modulated Operation
+             *
+             * This operation is the accumulating counterpart of getSamplesFrequencyModulated.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pRadiansPerSample A vector of rates, in radians per sample, at least as long as
+             * the number of samples requested.
+             */
+            void accumSamplesFrequencyModulated( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                                 const double * pRadiansPerSample );
+
             /**
              * @brief Reset Operation
              *
@@ -149,6 +602,30 @@ namespace ReiserRT
              */
             void reset( double radiansPerSample=0.0, double phi=0.0 );
 
+            /**
+             * @brief Skip Samples Operation
+             *
+             * This operation advances state by 'N' samples in constant time, as if 'N' samples had been
+             * generated and discarded. The phasor is rotated by rate^N, formed by repeated squaring in double-double
+             * arithmetic so that its angle holds to around 1e-16 radians (the rounding of the phasor) even for
+             * billions of samples, on any platform. The sample counter (and with it, normalization parity)
+             * advances by N.
+             *
+             * @param numSamples The number of samples to skip.
+             */
+            void skipSamples( size_t numSamples );
+
+            /**
+             * @brief Seek Operation
+             *
+             * This operation positions an instance so that the next sample delivered is the one at the
+             * given sample index, counting from construction or the last reset, at the current rate.
+             * It works in constant time, forward or backward.
+             *
+             * @param sampleIndex The index of the next sample to be delivered.
+             */
+            void seek( size_t sampleIndex );
+
             /**
              * @brief Get Sample Counter
              *
@@ -175,7 +652,58 @@ namespace ReiserRT
              */
              inline const FlyingPhasorElementType & peekNextSample() const { return phasor; }
 
+            /**
+             * @brief Get Instrumentation
+             *
+             * This operation returns a snapshot of the instrumentation counters. It is cheap, a copy of a few
+             * words and, may be invoked as often as desired. Without REISER_RT_FLYING_PHASOR_INSTRUMENTATION,
+             * the snapshot is all zeros.
+             *
+             * The worst magnitude error is that of the phasor just before each serial renormalization corrects
+             * it. The kernels keep their own extended precision phasor, whose error is far smaller and, is not
+             * tracked. Their renormalizations, one per block of samples, are counted.
+             *
+             * @return Returns a snapshot of the instrumentation counters.
+             */
+            Instrumentation getInstrumentation() const;
+
+            /**
+             * @brief Reset Instrumentation
+             *
+             * This operation zeros the instrumentation counters. Neither reset nor seek does so.
+             */
+            void resetInstrumentation();
+
+            /**
+             * @brief Get Kernel Name
+             *
+             * This operation returns the name of the multi-lane kernel selected for the running CPU, one of
+             * "generic", "avx2" or "avx512f". The selection is made once, on first use, and may be overridden
+             * (downward only) by setting the environment variable REISER_RT_FLYING_PHASOR_KERNEL beforehand.
+             * Throughput depends on it and so, it identifies what a throughput measurement was made with.
+             *
+             * @return Returns the name of the selected kernel.
+             */
+            static const char * getKernelName();
+
         private:
+            /**
+             * @brief The Process Events Operation.
+             *
+             * The common implementation of getSamplesWithEvents and accumSamplesWithEvents, once events have
+             * been validated.
+             */
+            double processEvents( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                  const Event * pEvents, size_t numEvents, double magnitude, bool accumulate );
+
+            /**
+             * @brief The Frequency Modulate Operation.
+             *
+             * The common implementation of getSamplesFrequencyModulated and accumSamplesFrequencyModulated.
+             */
+            void frequencyModulate( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                    const double * pRadiansPerSample, bool accumulate );
+
             /**
              * @brief The Normalize Operation.
              *
@@ -197,14 +725,59 @@ namespace ReiserRT
                     // This is a first order Taylor Series approximation around 1 for the sqrt function.
                     // The re-normalization adjustment is a scalar multiply (not complex multiply).
                     const double d = 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+                    instrumentNormalize( d );
                     phasor *= d;
                 }
             }
 
+#ifdef REISER_RT_FLYING_PHASOR_INSTRUMENTATION
+            /**
+             * @brief The Instrument Operation.
+             *
+             * Counts samples delivered by an operation.
+             */
+            inline void instrument( InstrumentedOperation op, size_t numSamples )
+            {
+                instrumentation.samples[ int( op ) ] += numSamples;
+            }
+
+            /**
+             * @brief The Instrument Kernel Operation.
+             *
+             * Counts the renormalizations performed by the kernels, one per whole block.
+             */
+            inline void instrumentKernel( size_t numBlocks )
+            {
+                instrumentation.renormalizations += numBlocks;
+            }
+
+            /**
+             * @brief The Instrument Normalize Operation.
+             *
+             * Counts a serial renormalization. The magnitude error of the phasor, to first order, is the
+             * correction factor's departure from one.
+             */
+            inline void instrumentNormalize( double d )
+            {
+                ++instrumentation.renormalizations;
+                const double error = d < 1.0 ? 1.0 - d : d - 1.0;
+                if ( instrumentation.worstMagnitudeError < error )
+                    instrumentation.worstMagnitudeError = error;
+            }
+#else
+            // Without instrumentation, these compile away to nothing.
+            inline void instrument( InstrumentedOperation, size_t ) {}
+            inline void instrumentKernel( size_t ) {}
+            inline void instrumentNormalize( double ) {}
+#endif
+
         private:
             FlyingPhasorElementType rate;
             FlyingPhasorElementType phasor;
             size_t sampleCounter;
+#ifdef REISER_RT_FLYING_PHASOR_INSTRUMENTATION
+            Instrumentation instrumentation{};
+#endif
         };
 
     }
@@ -10,6 +10,7 @@
 #define REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORDATATYPES_H
 
 #include <complex>
+#include <cstdint>
 
 namespace ReiserRT
 {
@@ -36,6 +37,65 @@ namespace ReiserRT
         * This is simply an alias for a pointer type to our FlyingPhasorElementType.
         */
         using FlyingPhasorElementBufferTypePtr = FlyingPhasorElementType *;
+
+        /**
+        * @brief Alias for Split Plane Buffer Type Pointer
+        *
+        * This is simply an alias for a pointer type to our FlyingPhasorPrecisionType. Split plane operations
+        * deliver real (I) and imaginary (Q) components into two separate buffers of these, one per sample each.
+        */
+        using FlyingPhasorPlaneBufferTypePtr = FlyingPhasorPrecisionType *;
+
+        /**
+        * @brief Alias for Single Precision Type
+        *
+        * This is simply an alias for a float (a 32bit IEEE 754 floating point value)
+        */
+        using FlyingPhasorFloatPrecisionType = float;
+
+        /**
+        * @brief Alias for Single Precision Complex Number Type
+        *
+        * This is simply an alias for a std::complex< FlyingPhasorFloatPrecisionType > or std::complex< float >.
+        */
+        using FlyingPhasorFloatElementType = std::complex< FlyingPhasorFloatPrecisionType >;
+
+        /**
+        * @brief Alias for Single Precision Buffer Type Pointer
+        *
+        * This is simply an alias for a pointer type to our FlyingPhasorFloatElementType.
+        */
+        using FlyingPhasorFloatElementBufferTypePtr = FlyingPhasorFloatElementType *;
+
+        /**
+        * @brief Alias for SC16 Component Type
+        *
+        * This is simply an alias for an int16_t. SC16 buffers hold interleaved I/Q pairs of these,
+        * two per sample.
+        */
+        using FlyingPhasorSC16Type = int16_t;
+
+        /**
+        * @brief Alias for SC16 Buffer Type Pointer
+        *
+        * This is simply an alias for a pointer type to our FlyingPhasorSC16Type.
+        */
+        using FlyingPhasorSC16BufferTypePtr = FlyingPhasorSC16Type *;
+
+        /**
+        * @brief Alias for SC8 Component Type
+        *
+        * This is simply an alias for an int8_t. SC8 buffers hold interleaved I/Q pairs of these,
+        * two per sample.
+        */
+        using FlyingPhasorSC8Type = int8_t;
+
+        /**
+        * @brief Alias for SC8 Buffer Type Pointer
+        *
+        * This is simply an alias for a pointer type to our FlyingPhasorSC8Type.
+        */
+        using FlyingPhasorSC8BufferTypePtr = FlyingPhasorSC8Type *;
     }
 }
 
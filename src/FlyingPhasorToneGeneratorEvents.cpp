@@ -0,0 +1,89 @@
+/**
+ * @file FlyingPhasorToneGeneratorEvents.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Event Timeline Operations
+ *
+ * The stretches between events are handed to the scaled bulk operations, so the multi-lane kernels
+ * do the work wherever a stretch is long enough to warrant them. Applying an event costs no more than
+ * a polar conversion.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    void validateEvents( size_t numSamples, const FlyingPhasorToneGenerator::Event * pEvents, size_t numEvents )
+    {
+        for ( size_t e = 0; numEvents != e; ++e )
+        {
+            if ( numSamples < pEvents[ e ].sampleIndex )
+                throw std::invalid_argument{ "FlyingPhasorToneGenerator: Event sample index exceeds numSamples" };
+            if ( 0 != e && pEvents[ e ].sampleIndex < pEvents[ e - 1 ].sampleIndex )
+                throw std::invalid_argument{ "FlyingPhasorToneGenerator: Events must be sorted by sample index" };
+        }
+    }
+}
+
+double FlyingPhasorToneGenerator::getSamplesWithEvents( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                        size_t numSamples, const Event * pEvents, size_t numEvents,
+                                                        double magnitude )
+{
+    validateEvents( numSamples, pEvents, numEvents );
+    return processEvents( pElementBuffer, numSamples, pEvents, numEvents, magnitude, false );
+}
+
+double FlyingPhasorToneGenerator::accumSamplesWithEvents( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                          size_t numSamples, const Event * pEvents, size_t numEvents,
+                                                          double magnitude )
+{
+    validateEvents( numSamples, pEvents, numEvents );
+    return processEvents( pElementBuffer, numSamples, pEvents, numEvents, magnitude, true );
+}
+
+double FlyingPhasorToneGenerator::processEvents( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                                 const Event * pEvents, size_t numEvents,
+                                                 double magnitude, bool accumulate )
+{
+    size_t done = 0;
+    for ( size_t e = 0; numEvents != e; ++e )
+    {
+        // Deliver everything up to the event.
+        const size_t stretch = pEvents[ e ].sampleIndex - done;
+        if ( accumulate )
+            accumSamplesScaled( pElementBuffer + done, stretch, magnitude );
+        else
+            getSamplesScaled( pElementBuffer + done, stretch, magnitude );
+        done += stretch;
+
+        // Then apply it.
+        switch ( pEvents[ e ].type )
+        {
+            case EventType::Frequency:
+                rate = std::polar( 1.0, pEvents[ e ].value );
+                break;
+            case EventType::Phase:
+                phasor = std::polar( 1.0, pEvents[ e ].value );
+                break;
+            case EventType::PhaseShift:
+                phasor *= std::polar( 1.0, pEvents[ e ].value );
+                break;
+            case EventType::Magnitude:
+                magnitude = pEvents[ e ].value;
+                break;
+        }
+    }
+
+    // And, whatever remains after the last event.
+    if ( accumulate )
+        accumSamplesScaled( pElementBuffer + done, numSamples - done, magnitude );
+    else
+        getSamplesScaled( pElementBuffer + done, numSamples - done, magnitude );
+
+    return magnitude;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file FlyingPhasorToneGeneratorFixedPoint.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Fixed Point Operations
+ *
+ * The fixed point operations generate complex samples a chunk at a time into a small buffer on the stack,
+ * which stays in L1 cache, and convert each chunk straight into the user's integer buffer. The user needs
+ * no intermediate buffer of complex doubles (four to eight times the memory of the integer buffer) and,
+ * there is no separate pass over memory to scale and convert.
+ *
+ * Dither, when requested, is triangular PDF (the difference of two uniform variates) spanning plus or minus
+ * one LSB. It comes from a SplitMix64 generator seeded from the sample counter and rate so, results are
+ * repeatable, successive invocations do not repeat the same dither and, two instances at different
+ * frequencies accumulating into the same buffer do not add identical dither.
+ *
+ * The conversion itself is shared with FlyingPhasorToneBank, which sums its tones a chunk at a time in double
+ * precision and converts each chunk likewise, so that a sum of tones is rounded only once.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    class TpdfDither
+    {
+    public:
+        explicit TpdfDither( uint64_t seed ) : state{ seed } {}
+
+        uint64_t getState() const { return state; }
+
+        // Returns triangular PDF dither in the range (-1, 1).
+        inline double operator()()
+        {
+            const uint64_t r = next();
+            constexpr double twoToMinus32 = 1.0 / 4294967296.0;
+            return double( r >> 32 ) * twoToMinus32 - double( r & 0xFFFFFFFFu ) * twoToMinus32;
+        }
+
+    private:
+        // SplitMix64 (Steele, Lea and Flood). Small, fast and statistically sound for this purpose.
+        inline uint64_t next()
+        {
+            uint64_t z = ( state += 0x9E3779B97F4A7C15ull );
+            z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+            z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+            return z ^ ( z >> 31 );
+        }
+
+        uint64_t state;
+    };
+
+    // Round half away from zero after saturating. Saturating first keeps the conversion well defined.
+    // The gain is finite (see fixedPointSamples) and so, v is never a NaN, which would pass straight through.
+    template< typename T >
+    inline T saturateAndRound( double v )
+    {
+        constexpr double lo = std::numeric_limits< T >::min();
+        constexpr double hi = std::numeric_limits< T >::max();
+        v = std::min( std::max( v, lo ), hi );
+        return T( v + std::copysign( 0.5, v ) );
+    }
+
+    template< typename T >
+    void convert( const FlyingPhasorElementType * pSrc, T * pDst, size_t numSamples, double gain,
+                  bool accumulate, uint64_t * pDitherState )
+    {
+        TpdfDither tpdfDither{ pDitherState ? *pDitherState : 0 };
+        for ( size_t i = 0; numSamples != i; ++i, pDst += 2 )
+        {
+            double re = pSrc[ i ].real() * gain;
+            double im = pSrc[ i ].imag() * gain;
+            if ( accumulate )
+            {
+                re += pDst[ 0 ];
+                im += pDst[ 1 ];
+            }
+            if ( pDitherState )
+            {
+                re += tpdfDither();
+                im += tpdfDither();
+            }
+            pDst[ 0 ] = saturateAndRound< T >( re );
+            pDst[ 1 ] = saturateAndRound< T >( im );
+        }
+
+        if ( pDitherState )
+            *pDitherState = tpdfDither.getState();
+    }
+
+    // Generate a chunk at a time and convert each chunk into the user buffer.
+    template< typename T >
+    void fixedPointSamples( FlyingPhasorToneGenerator & gen, const FlyingPhasorElementType & rate, T * pIQBuffer,
+                            size_t numSamples, double fullScaleGain, bool accumulate, bool dither )
+    {
+        // A gain that is not finite would deliver NaN (zero times infinity, if nothing else), which has no integer
+        // to round to. It is rejected before anything is generated or, anything accumulated is disturbed.
+        const double gain = fullScaleGain * std::numeric_limits< T >::max();
+        if ( !std::isfinite( gain ) )
+            throw std::invalid_argument{ "FlyingPhasorToneGenerator: fullScaleGain must be finite" };
+
+        uint64_t ditherState = Detail::flyingPhasorDitherSeed( gen.getSampleCount(), rate );
+
+        FlyingPhasorElementType chunk[ Detail::flyingPhasorScratchChunkSize ];
+        while ( numSamples )
+        {
+            const size_t n = std::min( numSamples, Detail::flyingPhasorScratchChunkSize );
+            gen.getSamples( chunk, n );
+            convert( chunk, pIQBuffer, n, gain, accumulate, dither ? &ditherState : nullptr );
+            pIQBuffer += 2 * n;
+            numSamples -= n;
+        }
+    }
+}
+
+uint64_t Detail::flyingPhasorDitherSeed( size_t sampleCounter, const FlyingPhasorElementType & rate )
+{
+    uint64_t re, im;
+    const double rateRe = rate.real();
+    const double rateIm = rate.imag();
+    std::memcpy( &re, &rateRe, sizeof( re ) );
+    std::memcpy( &im, &rateIm, sizeof( im ) );
+    return uint64_t( sampleCounter ) ^ re ^ ( im << 1 );
+}
+
+void Detail::flyingPhasorConvertFixedPoint( const FlyingPhasorElementType * pSamples,
+                                            FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                            double gain, bool accumulate, uint64_t * pDitherState )
+{
+    convert( pSamples, pIQBuffer, numSamples, gain, accumulate, pDitherState );
+}
+
+void Detail::flyingPhasorConvertFixedPoint( const FlyingPhasorElementType * pSamples,
+                                            FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                            double gain, bool accumulate, uint64_t * pDitherState )
+{
+    convert( pSamples, pIQBuffer, numSamples, gain, accumulate, pDitherState );
+}
+
+void FlyingPhasorToneGenerator::getSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                                double fullScaleGain, bool dither )
+{
+    fixedPointSamples( *this, rate, pIQBuffer, numSamples, fullScaleGain, false, dither );
+}
+
+void FlyingPhasorToneGenerator::accumSamplesSC16( FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                                  double fullScaleGain, bool dither )
+{
+    fixedPointSamples( *this, rate, pIQBuffer, numSamples, fullScaleGain, true, dither );
+}
+
+void FlyingPhasorToneGenerator::getSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                               double fullScaleGain, bool dither )
+{
+    fixedPointSamples( *this, rate, pIQBuffer, numSamples, fullScaleGain, false, dither );
+}
+
+void FlyingPhasorToneGenerator::accumSamplesSC8( FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                                 double fullScaleGain, bool dither )
+{
+    fixedPointSamples( *this, rate, pIQBuffer, numSamples, fullScaleGain, true, dither );
+}
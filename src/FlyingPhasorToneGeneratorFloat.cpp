@@ -0,0 +1,206 @@
+/**
+ * @file FlyingPhasorToneGeneratorFloat.cpp
+ * @brief The Implementation file for the Single Precision Flying Phasor Tone Generator
+ *
+ * The serial loops mirror those of FlyingPhasorToneGenerator, rounding each sample to single precision as it
+ * is delivered. Larger requests are handed off to the single precision multi-lane kernels.
+ * See FlyingPhasorToneGeneratorFloatKernels.cpp for details.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorFloat.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+using namespace ReiserRT::Signal;
+
+FlyingPhasorToneGeneratorFloat::FlyingPhasorToneGeneratorFloat( double radiansPerSample, double phi )
+    : rate{ std::polar( 1.0, radiansPerSample ) }
+    , phasor{ std::polar( 1.0, phi ) }
+    , sampleCounter{}
+{
+}
+
+void FlyingPhasorToneGeneratorFloat::getSamples( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::Get, phasor, rate,
+                                                  pElementBuffer, numSamples, 1.0f, nullptr );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ = FlyingPhasorFloatElementType( phasor );
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::getSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+        float scalar )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::GetScaled, phasor, rate,
+                                                  pElementBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ = FlyingPhasorFloatElementType( phasor ) * scalar;
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::getSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+        const float * pScalars )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::GetEnveloped, phasor, rate,
+                                                  pElementBuffer, numSamples, 1.0f, pScalars );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ = FlyingPhasorFloatElementType( phasor ) * *pScalars++;
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::accumSamples( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::Accum, phasor, rate,
+                                                  pElementBuffer, numSamples, 1.0f, nullptr );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ += FlyingPhasorFloatElementType( phasor );
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::accumSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+        float scalar )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::AccumScaled, phasor, rate,
+                                                  pElementBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ += FlyingPhasorFloatElementType( phasor ) * scalar;
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::accumSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+        const float * pScalars )
+{
+    // Larger requests are handed off to the multi-lane kernels.
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorFloatKernel( Detail::FlyingPhasorKernelOp::AccumEnveloped, phasor, rate,
+                                                  pElementBuffer, numSamples, 1.0f, pScalars );
+        sampleCounter += numSamples;
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        // We always start with the current phasor to nail the very first sample (s0)
+        // and advance (rotate) afterward.
+        *pElementBuffer++ += FlyingPhasorFloatElementType( phasor ) * *pScalars++;
+
+        // Now advance (rotate) the phasor by our rate (complex multiply)
+        phasor *= rate;
+
+        // Perform normalization work. This only actually normalizes every 64th invocation.
+        // We invoke it to maintain that part of the state machine.
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGeneratorFloat::reset( double radiansPerSample, double phi )
+{
+    rate = std::polar( 1.0, radiansPerSample );
+    phasor = std::polar( 1.0, phi );
+    sampleCounter = 0;
+}
+
+FlyingPhasorFloatElementType FlyingPhasorToneGeneratorFloat::getSample()
+{
+    // We always start with the current phasor to nail the very first sample (s0)
+    // and advance (rotate) afterward.
+    auto retValue = FlyingPhasorFloatElementType( phasor );
+
+    // Now advance (rotate) the phasor by our rate (complex multiply)
+    phasor *= rate;
+
+    // Perform normalization work. This only actually normalizes every 64th invocation.
+    // We invoke it to maintain that part of the state machine.
+    normalize();
+
+    return retValue;
+}
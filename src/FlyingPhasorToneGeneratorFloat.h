@@ -0,0 +1,198 @@
+/**
+ * @file FlyingPhasorToneGeneratorFloat.h
+ * @brief The Specification file for the Single Precision Flying Phasor Tone Generator
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORFLOAT_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORFLOAT_H
+
+#include "ReiserRT_FlyingPhasorExport.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class FlyingPhasorToneGeneratorFloat
+         *
+         * This is the single precision counterpart of FlyingPhasorToneGenerator for pipelines that work in
+         * std::complex< float > throughout. It delivers directly into single precision buffers, sparing a
+         * conversion pass and half of the memory traffic. The interface mirrors that of FlyingPhasorToneGenerator.
+         *
+         * State is carried in double precision. Only what is delivered is single precision. A rate phasor
+         * rounded to float would be off frequency by as much as half a float ULP of angle per sample, which
+         * no amount of care afterward could take back out. Carrying state in double costs nothing
+         * on the serial path (the complex multiply latency is much the same either way) and, the multi-lane kernels
+         * derive their samples in single precision, getting twice the samples per SIMD register. As with
+         * FlyingPhasorToneGenerator, those kernels serve requests of 128 samples or more. Smaller ones are serial.
+         *
+         * Normalization is tuned for single precision output. Drift in the double precision state is so far below
+         * what a float can resolve that normalizing every other sample buys nothing. We normalize every 64th sample
+         * instead, which shortens the serial dependency chain. Any resultant spur sits at fs/64, some 180 dB down,
+         * well beneath single precision quantization noise.
+         */
+        class ReiserRT_FlyingPhasor_EXPORT FlyingPhasorToneGeneratorFloat
+        {
+        public:
+            /**
+             * @brief Construct a Single Precision Flying Phasor Instance
+             *
+             * This operation constructs a FlyingPhasorToneGeneratorFloat instance.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             */
+            explicit FlyingPhasorToneGeneratorFloat( double radiansPerSample=0.0, double phi=0.0 );
+
+            /**
+             * @brief Destruct a Single Precision Flying Phasor Instance
+             *
+             * This operation is defaulted. There is nothing to do or clean up.
+             */
+            ~FlyingPhasorToneGeneratorFloat() = default;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be multiplied against each sample.
+             */
+            void getSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   float scalar );
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer.
+             * The samples are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void getSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const float * pScalars );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples from the tone generator into the user provided buffer.
+             * The samples accumulated are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer  User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            void accumSamples( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples from the tone generator into the user provided buffer.
+             * The samples accumulated are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar The scalar to be multiplied against each sample before accumulating.
+             */
+            void accumSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     float scalar );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples from the tone generator into the user provided buffer.
+             * The samples accumulated are scaled by user provided scalar vector representing a magnitude envelope.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param pScalars A vector of scalars at least as long as the number of samples requested.
+             */
+            void accumSamplesScaled( FlyingPhasorFloatElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     const float * pScalars );
+
+            /**
+             * @brief Reset Operation
+             *
+             * This operation resets an instance to a known state. It sets
+             * an instantaneous phase, a fixed frequency in radians per sample
+             * and, zeroes out of the sampleCounter. Object state is as if the object had just been
+             * constructed with the same parameters.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             */
+            void reset( double radiansPerSample=0.0, double phi=0.0 );
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * This operation returns the current value of the sample counter.
+             *
+             * @return Returns the current value of the sample counter.
+             */
+            inline size_t getSampleCount() const { return sampleCounter; }
+
+            /**
+             * @brief Get Single Sample Operation
+             *
+             * This operation returns a single sample, advancing state towards the next.
+             *
+             * @return Returns a single complex sinusoid sample advanced from previous state.
+             */
+            FlyingPhasorFloatElementType getSample();
+
+            /**
+             * @brief Peek Next Sample
+             *
+             * This operation exists for uses cases, where querying the current phase of an instance is necessary
+             * without 'working' the machine. The phasor state remains unchanged. The state is returned in
+             * the double precision it is carried in.
+             */
+            inline const FlyingPhasorElementType & peekNextSample() const { return phasor; }
+
+        private:
+            /**
+             * @brief The Normalize Operation.
+             *
+             * Normalize every 64 iterations. See the class description.
+             * Declared inline here for efficient reuse within the implementation.
+             */
+            inline void normalize( )
+            {
+                if ( ( sampleCounter++ & 0x3F ) == 0x3F )
+                {
+                    // First order Taylor Series approximation of 1/sqrt around 1.
+                    // See FlyingPhasorToneGenerator::normalize.
+                    const double d = 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+                    phasor *= d;
+                }
+            }
+
+        private:
+            FlyingPhasorElementType rate;
+            FlyingPhasorElementType phasor;
+            size_t sampleCounter;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORFLOAT_H
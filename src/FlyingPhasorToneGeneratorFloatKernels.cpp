@@ -0,0 +1,462 @@
+/**
+ * @file FlyingPhasorToneGeneratorFloatKernels.cpp
+ * @brief The Implementation file for the Flying Phasor Single Precision Multi-Lane Kernels
+ *
+ * These follow the double precision kernels (see FlyingPhasorToneGeneratorKernels.cpp) and are dispatched
+ * to the same instruction set. A master phasor is advanced by rate^K once per block and normalized every block.
+ * The K samples of a block are derived from the master independently of one another as master * rate^k.
+ *
+ * The master and the powers of rate are carried in double precision, which is far more than single precision
+ * samples require. Lanes are derived in single precision from float hi/lo pairs of both, so each sample comes
+ * out within a couple of ULPs of the correctly rounded float. Nothing derived in single precision is ever fed back
+ * into the master and so, single precision rounding never accumulates into phase or magnitude drift.
+ *
+ * As with the double precision kernels, complex multiplication is spelled out, every kernel performs the same
+ * IEEE-754 operations in the same order, and this file is compiled without floating point contraction.
+ * The result is bit for bit identical whichever kernel runs.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <cmath>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define REISER_RT_FLYING_PHASOR_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+using namespace ReiserRT::Signal;
+using namespace ReiserRT::Signal::Detail;
+
+namespace
+{
+    constexpr size_t K = flyingPhasorLaneCount;
+
+    // Lane seeding data, computed once per kernel invocation from the rate phasor.
+    struct LaneSeeds
+    {
+        // The powers rate^k for k in [0, K), rounded to float, plus the residuals that rounding discarded.
+        float powRe[ K ];
+        float powIm[ K ];
+        float powLoRe[ K ];
+        float powLoIm[ K ];
+
+        // The same with each element duplicated so they line up with interleaved I/Q sample pairs.
+        float powReDup[ 2 * K ];
+        float powImDup[ 2 * K ];
+        float powLoReDup[ 2 * K ];
+        float powLoImDup[ 2 * K ];
+
+        // The powers in double precision, for handing the next phasor back to the generator.
+        double powReD[ K ];
+        double powImD[ K ];
+
+        // rate^K.
+        double stepRe;
+        double stepIm;
+    };
+
+    // The master phasor in double precision, made available to the lanes as a rounded float (hi)
+    // plus the residual that rounding discarded (lo).
+    struct Master
+    {
+        double re;
+        double im;
+
+        float hiRe;
+        float hiIm;
+        float loRe;
+        float loIm;
+
+        explicit Master( const FlyingPhasorElementType & phasor )
+            : re{ phasor.real() }, im{ phasor.imag() }
+        {
+            refresh();
+        }
+
+        inline void refresh()
+        {
+            hiRe = float( re );
+            hiIm = float( im );
+            loRe = float( re - hiRe );
+            loIm = float( im - hiIm );
+        }
+    };
+
+    void seedLanes( const FlyingPhasorElementType & rate, LaneSeeds & seeds )
+    {
+        // Take only the angle of the rate phasor. See the double precision kernels.
+        const double rMag = std::sqrt( rate.real() * rate.real() + rate.imag() * rate.imag() );
+        const double rRe = rate.real() / rMag;
+        const double rIm = rate.imag() / rMag;
+        double pRe = 1.0;
+        double pIm = 0.0;
+        for ( size_t k = 0; K != k; ++k )
+        {
+            seeds.powReD[ k ] = pRe;
+            seeds.powImD[ k ] = pIm;
+            seeds.powRe[ k ] = seeds.powReDup[ 2 * k ] = seeds.powReDup[ 2 * k + 1 ] = float( pRe );
+            seeds.powIm[ k ] = seeds.powImDup[ 2 * k ] = seeds.powImDup[ 2 * k + 1 ] = float( pIm );
+            seeds.powLoRe[ k ] = seeds.powLoReDup[ 2 * k ] = seeds.powLoReDup[ 2 * k + 1 ] =
+                    float( pRe - seeds.powRe[ k ] );
+            seeds.powLoIm[ k ] = seeds.powLoImDup[ 2 * k ] = seeds.powLoImDup[ 2 * k + 1 ] =
+                    float( pIm - seeds.powIm[ k ] );
+
+            const double tRe = pRe * rRe - pIm * rIm;
+            pIm = pRe * rIm + pIm * rRe;
+            pRe = tRe;
+        }
+        seeds.stepRe = pRe;
+        seeds.stepIm = pIm;
+    }
+
+    // Advance the master phasor by one block (rate^K) and normalize it.
+    inline void advanceMaster( const LaneSeeds & seeds, Master & m )
+    {
+        const double re = m.re * seeds.stepRe - m.im * seeds.stepIm;
+        const double im = m.im * seeds.stepRe + m.re * seeds.stepIm;
+
+        // First order Taylor Series approximation of 1/sqrt around 1. See FlyingPhasorToneGenerator::normalize.
+        const double d = 1.0 - ( re * re + im * im - 1.0 ) / 2.0;
+        m.re = re * d;
+        m.im = im * d;
+        m.refresh();
+    }
+
+    // Derive lane k from the master: (hi + lo) * (pow + powLo), dropping lo * powLo. Real parts subtract,
+    // which we express as adding the product with -hiIm so that both components take identical operations.
+    // The SIMD kernels perform exactly these operations, in this order.
+    inline void deriveLane( const LaneSeeds & seeds, const Master & m, size_t k, float & re, float & im )
+    {
+        const float sRe = m.hiRe * seeds.powRe[ k ] + -m.hiIm * seeds.powIm[ k ];
+        const float cRe = ( m.hiRe * seeds.powLoRe[ k ] + -m.hiIm * seeds.powLoIm[ k ] ) +
+                          ( m.loRe * seeds.powRe[ k ] + -m.loIm * seeds.powIm[ k ] );
+        re = sRe + cRe;
+
+        const float sIm = m.hiIm * seeds.powRe[ k ] + m.hiRe * seeds.powIm[ k ];
+        const float cIm = ( m.hiIm * seeds.powLoRe[ k ] + m.hiRe * seeds.powLoIm[ k ] ) +
+                          ( m.loIm * seeds.powRe[ k ] + m.loRe * seeds.powIm[ k ] );
+        im = sIm + cIm;
+    }
+
+    // Deliver a single sample into the user buffer according to the operation.
+    template< FlyingPhasorKernelOp op >
+    inline void emitSample( float * pOut, float re, float im, float scalar, const float * pScalars, size_t n )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                pOut[ 0 ] = re;
+                pOut[ 1 ] = im;
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+                pOut[ 0 ] = re * scalar;
+                pOut[ 1 ] = im * scalar;
+                break;
+            case FlyingPhasorKernelOp::GetEnveloped:
+                pOut[ 0 ] = re * pScalars[ n ];
+                pOut[ 1 ] = im * pScalars[ n ];
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                pOut[ 0 ] += re;
+                pOut[ 1 ] += im;
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+                pOut[ 0 ] += re * scalar;
+                pOut[ 1 ] += im * scalar;
+                break;
+            case FlyingPhasorKernelOp::AccumEnveloped:
+                pOut[ 0 ] += re * pScalars[ n ];
+                pOut[ 1 ] += im * pScalars[ n ];
+                break;
+        }
+    }
+
+    template< FlyingPhasorKernelOp op >
+    void genericLanes( const LaneSeeds & seeds, const Master & m, float * pOut, size_t numLanes,
+                       float scalar, const float * pScalars, size_t n )
+    {
+        for ( size_t k = 0; numLanes != k; ++k )
+        {
+            float re, im;
+            deriveLane( seeds, m, k, re, im );
+            emitSample< op >( pOut + 2 * k, re, im, scalar, pScalars, n + k );
+        }
+    }
+
+    using LanesFunction = void (*)( const LaneSeeds &, const Master &, float *, size_t,
+                                    float, const float *, size_t );
+
+    using BlocksFunction = void (*)( const LaneSeeds &, Master &, float *, size_t,
+                                     float, const float * );
+
+    template< FlyingPhasorKernelOp op >
+    void genericBlocks( const LaneSeeds & seeds, Master & m, float * pOut, size_t numBlocks,
+                        float scalar, const float * pScalars )
+    {
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            genericLanes< op >( seeds, m, pOut + 2 * K * b, K, scalar, pScalars, K * b );
+            advanceMaster( seeds, m );
+        }
+    }
+
+    constexpr bool isEnveloped( FlyingPhasorKernelOp op )
+    {
+        return FlyingPhasorKernelOp::GetEnveloped == op || FlyingPhasorKernelOp::AccumEnveloped == op;
+    }
+
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+    // AVX2 Kernel. Each 256 bit register holds four interleaved I/Q samples.
+    struct Avx2Master
+    {
+        __m256 hi;     // [ hiRe, hiIm, ... ]
+        __m256 hiSwN;  // [ -hiIm, hiRe, ... ]
+        __m256 lo;     // [ loRe, loIm, ... ]
+        __m256 loSwN;  // [ -loIm, loRe, ... ]
+    };
+
+    __attribute__(( target( "avx2" ) ))
+    inline __m256 deriveLanesAvx2( const Avx2Master & m, const float * pr, const float * pi,
+                                   const float * plr, const float * pli )
+    {
+        const __m256 vpr = _mm256_loadu_ps( pr );
+        const __m256 vpi = _mm256_loadu_ps( pi );
+        const __m256 s = _mm256_add_ps( _mm256_mul_ps( m.hi, vpr ), _mm256_mul_ps( m.hiSwN, vpi ) );
+        const __m256 c = _mm256_add_ps(
+                _mm256_add_ps( _mm256_mul_ps( m.hi, _mm256_loadu_ps( plr ) ), _mm256_mul_ps( m.hiSwN, _mm256_loadu_ps( pli ) ) ),
+                _mm256_add_ps( _mm256_mul_ps( m.lo, vpr ), _mm256_mul_ps( m.loSwN, vpi ) ) );
+        return _mm256_add_ps( s, c );
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx2" ) ))
+    inline void emitAvx2( float * pOut, __m256 lane, __m256 sc, const float * pScalars )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                _mm256_storeu_ps( pOut, lane );
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+                _mm256_storeu_ps( pOut, _mm256_mul_ps( lane, sc ) );
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                _mm256_storeu_ps( pOut, _mm256_add_ps( _mm256_loadu_ps( pOut ), lane ) );
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+                _mm256_storeu_ps( pOut, _mm256_add_ps( _mm256_loadu_ps( pOut ), _mm256_mul_ps( lane, sc ) ) );
+                break;
+            case FlyingPhasorKernelOp::GetEnveloped:
+            case FlyingPhasorKernelOp::AccumEnveloped:
+            {
+                // [ s0, s0, s1, s1, s2, s2, s3, s3 ]
+                const __m256 env = _mm256_permutevar8x32_ps( _mm256_castps128_ps256( _mm_loadu_ps( pScalars ) ),
+                                                             _mm256_setr_epi32( 0, 0, 1, 1, 2, 2, 3, 3 ) );
+                if ( FlyingPhasorKernelOp::GetEnveloped == op )
+                    _mm256_storeu_ps( pOut, _mm256_mul_ps( lane, env ) );
+                else
+                    _mm256_storeu_ps( pOut, _mm256_add_ps( _mm256_loadu_ps( pOut ), _mm256_mul_ps( lane, env ) ) );
+                break;
+            }
+        }
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx2" ) ))
+    void avx2Blocks( const LaneSeeds & seeds, Master & m, float * pOut, size_t numBlocks,
+                     float scalar, const float * pScalars )
+    {
+        constexpr size_t V = K / 4;
+        const __m256 sc = _mm256_set1_ps( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx2Master vm{
+                    _mm256_setr_ps( m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm ),
+                    _mm256_setr_ps( -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe ),
+                    _mm256_setr_ps( m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm ),
+                    _mm256_setr_ps( -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m256 lane = deriveLanesAvx2( vm, seeds.powReDup + 8 * v, seeds.powImDup + 8 * v,
+                                                     seeds.powLoReDup + 8 * v, seeds.powLoImDup + 8 * v );
+                emitAvx2< op >( pOut + 8 * v, lane, sc, isEnveloped( op ) ? pScalars + 4 * v : nullptr );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+    }
+
+    // AVX-512F Kernel. Eight interleaved I/Q samples per register. Otherwise, identical to the AVX2 kernel.
+    struct Avx512Master
+    {
+        __m512 hi;
+        __m512 hiSwN;
+        __m512 lo;
+        __m512 loSwN;
+    };
+
+    __attribute__(( target( "avx512f" ) ))
+    inline __m512 deriveLanesAvx512( const Avx512Master & m, const float * pr, const float * pi,
+                                     const float * plr, const float * pli )
+    {
+        const __m512 vpr = _mm512_loadu_ps( pr );
+        const __m512 vpi = _mm512_loadu_ps( pi );
+        const __m512 s = _mm512_add_ps( _mm512_mul_ps( m.hi, vpr ), _mm512_mul_ps( m.hiSwN, vpi ) );
+        const __m512 c = _mm512_add_ps(
+                _mm512_add_ps( _mm512_mul_ps( m.hi, _mm512_loadu_ps( plr ) ), _mm512_mul_ps( m.hiSwN, _mm512_loadu_ps( pli ) ) ),
+                _mm512_add_ps( _mm512_mul_ps( m.lo, vpr ), _mm512_mul_ps( m.loSwN, vpi ) ) );
+        return _mm512_add_ps( s, c );
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx512f" ) ))
+    inline void emitAvx512( float * pOut, __m512 lane, __m512 sc, const float * pScalars )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                _mm512_storeu_ps( pOut, lane );
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+                _mm512_storeu_ps( pOut, _mm512_mul_ps( lane, sc ) );
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                _mm512_storeu_ps( pOut, _mm512_add_ps( _mm512_loadu_ps( pOut ), lane ) );
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+                _mm512_storeu_ps( pOut, _mm512_add_ps( _mm512_loadu_ps( pOut ), _mm512_mul_ps( lane, sc ) ) );
+                break;
+            case FlyingPhasorKernelOp::GetEnveloped:
+            case FlyingPhasorKernelOp::AccumEnveloped:
+            {
+                // [ s0, s0, s1, s1, ... s7, s7 ]
+                const __m512 env = _mm512_maskz_permutexvar_ps(
+                        0xFFFF, _mm512_setr_epi32( 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 ),
+                        _mm512_maskz_loadu_ps( 0x00FF, pScalars ) );
+                if ( FlyingPhasorKernelOp::GetEnveloped == op )
+                    _mm512_storeu_ps( pOut, _mm512_mul_ps( lane, env ) );
+                else
+                    _mm512_storeu_ps( pOut, _mm512_add_ps( _mm512_loadu_ps( pOut ), _mm512_mul_ps( lane, env ) ) );
+                break;
+            }
+        }
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx512f" ) ))
+    void avx512Blocks( const LaneSeeds & seeds, Master & m, float * pOut, size_t numBlocks,
+                       float scalar, const float * pScalars )
+    {
+        constexpr size_t V = K / 8;
+        const __m512 sc = _mm512_set1_ps( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx512Master vm{
+                    _mm512_setr_ps( m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm,
+                                    m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm ),
+                    _mm512_setr_ps( -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe,
+                                    -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe ),
+                    _mm512_setr_ps( m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm,
+                                    m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm ),
+                    _mm512_setr_ps( -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe,
+                                    -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m512 lane = deriveLanesAvx512( vm, seeds.powReDup + 16 * v, seeds.powImDup + 16 * v,
+                                                       seeds.powLoReDup + 16 * v, seeds.powLoImDup + 16 * v );
+                emitAvx512< op >( pOut + 16 * v, lane, sc, isEnveloped( op ) ? pScalars + 8 * v : nullptr );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+    }
+#endif
+
+    const LanesFunction genericLanesTable[ 6 ] = {
+            genericLanes< FlyingPhasorKernelOp::Get >,
+            genericLanes< FlyingPhasorKernelOp::GetScaled >,
+            genericLanes< FlyingPhasorKernelOp::GetEnveloped >,
+            genericLanes< FlyingPhasorKernelOp::Accum >,
+            genericLanes< FlyingPhasorKernelOp::AccumScaled >,
+            genericLanes< FlyingPhasorKernelOp::AccumEnveloped >
+    };
+
+    const BlocksFunction genericBlocksTable[ 6 ] = {
+            genericBlocks< FlyingPhasorKernelOp::Get >,
+            genericBlocks< FlyingPhasorKernelOp::GetScaled >,
+            genericBlocks< FlyingPhasorKernelOp::GetEnveloped >,
+            genericBlocks< FlyingPhasorKernelOp::Accum >,
+            genericBlocks< FlyingPhasorKernelOp::AccumScaled >,
+            genericBlocks< FlyingPhasorKernelOp::AccumEnveloped >
+    };
+
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+    const BlocksFunction avx2BlocksTable[ 6 ] = {
+            avx2Blocks< FlyingPhasorKernelOp::Get >,
+            avx2Blocks< FlyingPhasorKernelOp::GetScaled >,
+            avx2Blocks< FlyingPhasorKernelOp::GetEnveloped >,
+            avx2Blocks< FlyingPhasorKernelOp::Accum >,
+            avx2Blocks< FlyingPhasorKernelOp::AccumScaled >,
+            avx2Blocks< FlyingPhasorKernelOp::AccumEnveloped >
+    };
+
+    const BlocksFunction avx512BlocksTable[ 6 ] = {
+            avx512Blocks< FlyingPhasorKernelOp::Get >,
+            avx512Blocks< FlyingPhasorKernelOp::GetScaled >,
+            avx512Blocks< FlyingPhasorKernelOp::GetEnveloped >,
+            avx512Blocks< FlyingPhasorKernelOp::Accum >,
+            avx512Blocks< FlyingPhasorKernelOp::AccumScaled >,
+            avx512Blocks< FlyingPhasorKernelOp::AccumEnveloped >
+    };
+#endif
+
+    const BlocksFunction * selectedBlocksTable()
+    {
+        switch ( flyingPhasorKernelIsa() )
+        {
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+            case FlyingPhasorKernelIsa::Avx512f: return avx512BlocksTable;
+            case FlyingPhasorKernelIsa::Avx2: return avx2BlocksTable;
+#endif
+            default: return genericBlocksTable;
+        }
+    }
+}
+
+FlyingPhasorElementType Detail::flyingPhasorFloatKernel( FlyingPhasorKernelOp op,
+                                                         const FlyingPhasorElementType & phasor,
+                                                         const FlyingPhasorElementType & rate,
+                                                         FlyingPhasorFloatElementBufferTypePtr pElementBuffer,
+                                                         size_t numSamples,
+                                                         float scalar, const float * pScalars )
+{
+    LaneSeeds seeds;
+    seedLanes( rate, seeds );
+
+    // The std::complex array-oriented access guarantee (C++11 26.4) lets us treat the buffer as interleaved floats.
+    auto pOut = reinterpret_cast< float * >( pElementBuffer );
+    Master m{ phasor };
+
+    // Whole blocks first, by whichever kernel was selected.
+    const size_t numBlocks = numSamples / K;
+    selectedBlocksTable()[ int( op ) ]( seeds, m, pOut, numBlocks, scalar, pScalars );
+
+    // Then, whatever partial block remains.
+    const size_t done = numBlocks * K;
+    const size_t remaining = numSamples - done;
+    genericLanesTable[ int( op ) ]( seeds, m, pOut + 2 * done, remaining, scalar, pScalars, done );
+
+    // The next sample is the next lane, handed back in double precision.
+    return FlyingPhasorElementType{ m.re * seeds.powReD[ remaining ] - m.im * seeds.powImD[ remaining ],
+                                    m.im * seeds.powReD[ remaining ] + m.re * seeds.powImD[ remaining ] };
+}
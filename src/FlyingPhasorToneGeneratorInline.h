@@ -0,0 +1,233 @@
+/**
+ * @file FlyingPhasorToneGeneratorInline.h
+ * @brief The Specification and Implementation file for the Inline Flying Phasor Tone Generator
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORINLINE_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORINLINE_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+#include "FlyingPhasorNormalizationPolicies.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * Class Template FlyingPhasorToneGeneratorInline
+         *
+         * This is a header only counterpart of FlyingPhasorToneGenerator for use in tight, per sample loops.
+         * FlyingPhasorToneGenerator lives in a shared library and so, every getSample invocation is an out of
+         * line function call, followed by a test of the sample counter to decide whether to normalize.
+         * Here, everything is visible to the compiler, which may inline it into the caller's loop.
+         *
+         * The normalization period is a template parameter and must be a power of two. Bulk operations
+         * generate whole periods at a time, with normalization at the end of each. The compiler
+         * sees a fixed trip count and can unroll the period away, leaving no per sample test at all.
+         * With the default period of two, samples are bit for bit those of FlyingPhasorToneGenerator's
+         * getSample. Longer periods trade a little purity for speed. See FlyingPhasorToneGenerator::normalize.
+         * The normalization policy selects how the correction is computed. See FlyingPhasorNormalizationPolicies.h.
+         * The sundry normalizationReport utility measures the cost and purity of each combination side by side.
+         *
+         * There are no multi-lane kernels here. For large buffers, FlyingPhasorToneGenerator's
+         * getSamples is faster still.
+         *
+         * @tparam NormalizationPeriod The number of samples between normalizations. A power of two.
+         * @tparam NormalizationPolicy A type with a static correction( magnitudeSquared ) operation returning
+         * the scalar that restores the phasor to unit magnitude.
+         */
+        template< size_t NormalizationPeriod = 2, typename NormalizationPolicy = FirstOrderTaylorNormalization >
+        class FlyingPhasorToneGeneratorInline
+        {
+            static_assert( 0 != NormalizationPeriod && 0 == ( NormalizationPeriod & ( NormalizationPeriod - 1 ) ),
+                           "NormalizationPeriod must be a power of two" );
+
+        public:
+            /**
+             * @brief Construct an Inline Flying Phasor Tone Generator Instance
+             *
+             * This operation constructs an instance as FlyingPhasorToneGenerator would.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             */
+            explicit FlyingPhasorToneGeneratorInline( double radiansPerSample=0.0, double phi=0.0 )
+                : rate{ std::polar( 1.0, radiansPerSample ) }
+                , phasor{ std::polar( 1.0, phi ) }
+                , sampleCounter{}
+            {
+            }
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number samples into the user provided buffer.
+             * The samples are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            inline void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+            {
+                generate( numSamples, [ &pElementBuffer ]( const FlyingPhasorElementType & s ){ *pElementBuffer++ = s; } );
+            }
+
+            /**
+             * @brief Get Samples Scaled Operation
+             *
+             * This operation delivers 'N' number samples into the user provided buffer.
+             * The samples are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be multiplied against each sample.
+             */
+            inline void getSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                          double scalar )
+            {
+                generate( numSamples, [ &pElementBuffer, scalar ]( const FlyingPhasorElementType & s ){ *pElementBuffer++ = s * scalar; } );
+            }
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples into the user provided buffer.
+             * The samples accumulated are unscaled (i.e., a magnitude of one).
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             */
+            inline void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+            {
+                generate( numSamples, [ &pElementBuffer ]( const FlyingPhasorElementType & s ){ *pElementBuffer++ += s; } );
+            }
+
+            /**
+             * @brief Accumulate Samples Scaled Operation
+             *
+             * This operation accumulates 'N' number of samples into the user provided buffer.
+             * The samples accumulated are scaled by user provided scalar.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be accumulated.
+             * @param scalar The scalar to be multiplied against each sample before accumulating.
+             */
+            inline void accumSamplesScaled( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                            double scalar )
+            {
+                generate( numSamples, [ &pElementBuffer, scalar ]( const FlyingPhasorElementType & s ){ *pElementBuffer++ += s * scalar; } );
+            }
+
+            /**
+             * @brief Reset Operation
+             *
+             * This operation resets an instance to a known state, as if it had just been constructed
+             * with the same parameters.
+             *
+             * @param radiansPerSample The number of radians to advance each sample (synonymous with frequency).
+             * @param phi The initial phase of the state phasor in radians.
+             */
+            inline void reset( double radiansPerSample=0.0, double phi=0.0 )
+            {
+                rate = std::polar( 1.0, radiansPerSample );
+                phasor = std::polar( 1.0, phi );
+                sampleCounter = 0;
+            }
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * This operation returns the current value of the sample counter.
+             *
+             * @return Returns the current value of the sample counter.
+             */
+            inline size_t getSampleCount() const { return sampleCounter; }
+
+            /**
+             * @brief Get Single Sample Operation
+             *
+             * This operation returns a single sample, advancing state towards the next.
+             *
+             * @return Returns a single complex sinusoid sample advanced from previous state.
+             */
+            inline FlyingPhasorElementType getSample()
+            {
+                auto retValue = phasor;
+                phasor *= rate;
+                if ( ( sampleCounter++ & mask ) == mask )
+                    normalize();
+                return retValue;
+            }
+
+            /**
+             * @brief Peek Next Sample
+             *
+             * This operation exists for uses cases, where querying the current phase of an instance is necessary
+             * without 'working' the machine. The phasor state remains unchanged.
+             */
+            inline const FlyingPhasorElementType & peekNextSample() const { return phasor; }
+
+        private:
+            /**
+             * @brief The Period Mask
+             *
+             * Super-fast modulo of the sample counter by the normalization period.
+             */
+            static constexpr size_t mask = NormalizationPeriod - 1;
+
+            /**
+             * @brief The Normalize Operation.
+             *
+             * Scales the phasor by the correction of the normalization policy. By default, a first order
+             * Taylor Series approximation of 1/sqrt around 1, as FlyingPhasorToneGenerator uses.
+             */
+            inline void normalize()
+            {
+                phasor *= NormalizationPolicy::correction( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() );
+            }
+
+            /**
+             * @brief The Generate Operation.
+             *
+             * Hands 'N' samples to the sink in turn. Samples up to a period boundary go one at a time.
+             * After that, whole periods go with normalization only at the end of each. Any remainder goes one
+             * at a time again.
+             */
+            template< typename Sink >
+            inline void generate( size_t numSamples, Sink sink )
+            {
+                while ( 0 != numSamples && 0 != ( sampleCounter & mask ) )
+                {
+                    sink( getSample() );
+                    --numSamples;
+                }
+
+                for ( size_t numPeriods = numSamples / NormalizationPeriod; 0 != numPeriods; --numPeriods )
+                {
+                    for ( size_t i = 0; NormalizationPeriod != i; ++i )
+                    {
+                        sink( phasor );
+                        phasor *= rate;
+                    }
+                    normalize();
+                }
+                sampleCounter += numSamples & ~mask;
+
+                for ( numSamples &= mask; 0 != numSamples; --numSamples )
+                    sink( getSample() );
+            }
+
+        private:
+            FlyingPhasorElementType rate;
+            FlyingPhasorElementType phasor;
+            size_t sampleCounter;
+        };
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORINLINE_H
@@ -0,0 +1,943 @@
+/**
+ * @file FlyingPhasorToneGeneratorKernels.cpp
+ * @brief The Implementation file for the Flying Phasor Multi-Lane Kernels
+ *
+ * The serial loops of the FlyingPhasorToneGenerator are one long dependency chain. Every sample must
+ * wait for the complex multiply that produced the previous one to complete. That leaves most of a modern
+ * core idle. The kernels here break that chain up.
+ *
+ * A single "master" phasor is advanced by rate^K once per block of K samples and normalized every block.
+ * The K samples of a block are derived from the master independently of one another as master * rate^k.
+ * Those K complex multiplies have no dependencies between them and map directly onto SIMD registers.
+ * We intentionally do not let K staggered phasors each free run at rate^K. Their rounding errors would
+ * random walk independently of one another and, adjacent samples come from different lanes. Phase noise
+ * would then grow with the run length. Deriving every lane from one master bounds it to a couple of ULPs.
+ *
+ * The powers of rate and the master are kept in long double. The master is only advanced once per block
+ * so, that costs little. Each lane is then formed from double hi/lo pairs of both, using exact products
+ * and sums, so that every sample is within a hair of the correctly rounded value. That keeps adjacent
+ * samples, which come from different lanes, as clean with respect to one another as the serial chain's.
+ *
+ * Complex multiplication is spelled out. We never touch std::complex's multiply (and libgcc's __muldc3).
+ * Every kernel performs the same IEEE-754 operations in the same order, and this file is compiled without
+ * floating point contraction. The SIMD kernels obtain exact product errors from FMA and the generic kernel
+ * from Dekker's algorithm, which are the same numbers. So, the result is bit for bit identical whichever
+ * kernel runs.
+ *
+ * Without FMA, Dekker's exact products cost the generic kernel more than breaking up the serial chain gains it,
+ * so it is slower than the serial loops it would replace. It only runs when forced (see flyingPhasorUseKernel),
+ * as the reference the SIMD kernels are held to. Otherwise, where no SIMD kernel is available, the serial loops
+ * service every request.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define REISER_RT_FLYING_PHASOR_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+using namespace ReiserRT::Signal;
+using namespace ReiserRT::Signal::Detail;
+
+namespace
+{
+    constexpr size_t K = flyingPhasorLaneCount;
+
+    // Veltkamp's splitting constant (2^27 + 1) for double precision.
+    constexpr double splitter = 134217729.0;
+
+    // Split a into high and low halves of 26 bits each, such that a == hi + lo exactly.
+    inline void split( double a, double & hi, double & lo )
+    {
+        const double c = splitter * a;
+        hi = c - ( c - a );
+        lo = a - hi;
+    }
+
+    // The exact rounding error of the product p = a * b, given a and b already split.
+    // This is Dekker's algorithm. It computes exactly what fma( a, b, -p ) would, without requiring one.
+    inline double productError( double aHi, double aLo, double bHi, double bLo, double p )
+    {
+#ifdef FP_FAST_FMA
+        return std::fma( aHi + aLo, bHi + bLo, -p );
+#else
+        return ( ( aHi * bHi - p ) + aHi * bLo + aLo * bHi ) + aLo * bLo;
+#endif
+    }
+
+    using LaneSeeds = FlyingPhasorLaneSeeds;
+    using Master = FlyingPhasorMaster;
+}
+
+void Detail::flyingPhasorSeedLanes( const FlyingPhasorElementType & rate, FlyingPhasorLaneSeeds & seeds )
+{
+    // The rate phasor was rounded to double and is not quite a unit vector. The serial generator renormalizes
+    // that away as it goes. We cannot afford to let the error compound across K powers so, we take
+    // only its angle.
+    const long double rMag = std::sqrt( (long double)rate.real() * rate.real() +
+                                        (long double)rate.imag() * rate.imag() );
+    const long double rRe = rate.real() / rMag;
+    const long double rIm = rate.imag() / rMag;
+    long double pRe = 1.0L;
+    long double pIm = 0.0L;
+    for ( size_t k = 0; K != k; ++k )
+    {
+        seeds.powRe[ k ] = seeds.powReDup[ 2 * k ] = seeds.powReDup[ 2 * k + 1 ] = double( pRe );
+        seeds.powIm[ k ] = seeds.powImDup[ 2 * k ] = seeds.powImDup[ 2 * k + 1 ] = double( pIm );
+        seeds.powLoRe[ k ] = seeds.powLoReDup[ 2 * k ] = seeds.powLoReDup[ 2 * k + 1 ] =
+                double( pRe - seeds.powRe[ k ] );
+        seeds.powLoIm[ k ] = seeds.powLoImDup[ 2 * k ] = seeds.powLoImDup[ 2 * k + 1 ] =
+                double( pIm - seeds.powIm[ k ] );
+        split( seeds.powRe[ k ], seeds.powReHi[ k ], seeds.powReLo[ k ] );
+        split( seeds.powIm[ k ], seeds.powImHi[ k ], seeds.powImLo[ k ] );
+
+        const long double tRe = pRe * rRe - pIm * rIm;
+        pIm = pRe * rIm + pIm * rRe;
+        pRe = tRe;
+    }
+    seeds.stepRe = pRe;
+    seeds.stepIm = pIm;
+}
+
+FlyingPhasorMaster::FlyingPhasorMaster( const FlyingPhasorElementType & phasor )
+    : re{ phasor.real() }, im{ phasor.imag() }
+{
+    refresh();
+}
+
+void FlyingPhasorMaster::refresh()
+{
+    hiRe = double( re );
+    hiIm = double( im );
+    loRe = double( re - hiRe );
+    loIm = double( im - hiIm );
+    split( hiRe, hiReHi, hiReLo );
+    split( hiIm, hiImHi, hiImLo );
+}
+
+namespace
+{
+    // Advance the master phasor by one block (rate^K) and normalize it. This is the only serial dependency
+    // left. It is shared by all kernels so that they agree bit for bit.
+    inline void advanceMaster( const LaneSeeds & seeds, Master & m )
+    {
+        const long double re = m.re * seeds.stepRe - m.im * seeds.stepIm;
+        const long double im = m.im * seeds.stepRe + m.re * seeds.stepIm;
+
+        // First order Taylor Series approximation of 1/sqrt around 1. See FlyingPhasorToneGenerator::normalize.
+        const long double d = 1.0L - ( re * re + im * im - 1.0L ) / 2.0L;
+        m.re = re * d;
+        m.im = im * d;
+        m.refresh();
+    }
+
+    // Derive lane k from the master. We want (hi + lo) * (pow + powLo), rounded once. The dominant
+    // product hi * pow is formed exactly, as a rounded sum plus its error terms, and then the small
+    // cross terms are added in (lo * powLo is negligible). Each output component ends up within a hair
+    // of correctly rounded, which is what lets adjacent samples, derived independently, be as clean as
+    // the serial chain. Real parts subtract, which we express as adding the product with -hiIm so that
+    // both components take identical operations. The SIMD kernels perform exactly these operations,
+    // in this order.
+    inline double deriveLaneReal( const LaneSeeds & seeds, const Master & m, size_t k )
+    {
+        // Real: hiRe * pRe + (-hiIm) * pIm
+        const double p1 = m.hiRe * seeds.powRe[ k ];
+        const double e1 = productError( m.hiReHi, m.hiReLo, seeds.powReHi[ k ], seeds.powReLo[ k ], p1 );
+        const double p2 = -m.hiIm * seeds.powIm[ k ];
+        const double e2 = productError( -m.hiImHi, -m.hiImLo, seeds.powImHi[ k ], seeds.powImLo[ k ], p2 );
+        const double sRe = p1 + p2;
+        const double bRe = sRe - p1;
+        const double esRe = ( p1 - ( sRe - bRe ) ) + ( p2 - bRe );
+        const double cRe = ( m.hiRe * seeds.powLoRe[ k ] + -m.hiIm * seeds.powLoIm[ k ] ) +
+                           ( m.loRe * seeds.powRe[ k ] + -m.loIm * seeds.powIm[ k ] );
+        return sRe + ( ( ( esRe + e1 ) + e2 ) + cRe );
+    }
+
+    inline double deriveLaneImag( const LaneSeeds & seeds, const Master & m, size_t k )
+    {
+        // Imaginary: hiIm * pRe + hiRe * pIm
+        const double p3 = m.hiIm * seeds.powRe[ k ];
+        const double e3 = productError( m.hiImHi, m.hiImLo, seeds.powReHi[ k ], seeds.powReLo[ k ], p3 );
+        const double p4 = m.hiRe * seeds.powIm[ k ];
+        const double e4 = productError( m.hiReHi, m.hiReLo, seeds.powImHi[ k ], seeds.powImLo[ k ], p4 );
+        const double sIm = p3 + p4;
+        const double bIm = sIm - p3;
+        const double esIm = ( p3 - ( sIm - bIm ) ) + ( p4 - bIm );
+        const double cIm = ( m.hiIm * seeds.powLoRe[ k ] + m.hiRe * seeds.powLoIm[ k ] ) +
+                           ( m.loIm * seeds.powRe[ k ] + m.loRe * seeds.powIm[ k ] );
+        return sIm + ( ( ( esIm + e3 ) + e4 ) + cIm );
+    }
+
+    inline void deriveLane( const LaneSeeds & seeds, const Master & m, size_t k, double & re, double & im )
+    {
+        re = deriveLaneReal( seeds, m, k );
+        im = deriveLaneImag( seeds, m, k );
+    }
+
+    // Deliver a single sample into the user buffer according to the operation. The components are
+    // passed by reference so that interleaved and split plane buffers are served alike.
+    template< FlyingPhasorKernelOp op >
+    inline void emitSample( double & outRe, double & outIm, double re, double im,
+                            double scalar, const double * pScalars, size_t n )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                outRe = re;
+                outIm = im;
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+                outRe = re * scalar;
+                outIm = im * scalar;
+                break;
+            case FlyingPhasorKernelOp::GetEnveloped:
+                outRe = re * pScalars[ n ];
+                outIm = im * pScalars[ n ];
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                outRe += re;
+                outIm += im;
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+                outRe += re * scalar;
+                outIm += im * scalar;
+                break;
+            case FlyingPhasorKernelOp::AccumEnveloped:
+                outRe += re * pScalars[ n ];
+                outIm += im * pScalars[ n ];
+                break;
+        }
+    }
+
+    // Deliver a single component, for the real only operations.
+    template< FlyingPhasorKernelOp op >
+    inline void emitComponent( double & out, double v, double scalar, const double * pScalars, size_t n )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get: out = v; break;
+            case FlyingPhasorKernelOp::GetScaled: out = v * scalar; break;
+            case FlyingPhasorKernelOp::GetEnveloped: out = v * pScalars[ n ]; break;
+            case FlyingPhasorKernelOp::Accum: out += v; break;
+            case FlyingPhasorKernelOp::AccumScaled: out += v * scalar; break;
+            case FlyingPhasorKernelOp::AccumEnveloped: out += v * pScalars[ n ]; break;
+        }
+    }
+
+    // Derive and deliver numLanes (at most K) samples from the master. Used by the generic kernel
+    // for whole blocks and by all kernels for the partial block at the tail end of a request.
+    template< FlyingPhasorKernelOp op >
+    void genericLanes( const LaneSeeds & seeds, const Master & m, double * pOut, size_t numLanes,
+                       double scalar, const double * pScalars, size_t n )
+    {
+        for ( size_t k = 0; numLanes != k; ++k )
+        {
+            double re, im;
+            deriveLane( seeds, m, k, re, im );
+            emitSample< op >( pOut[ 2 * k ], pOut[ 2 * k + 1 ], re, im, scalar, pScalars, n + k );
+        }
+    }
+
+    // The split plane counterpart of genericLanes. Without the imaginary plane (real only), pIm is not touched
+    // and the imaginary components are never derived.
+    template< FlyingPhasorKernelOp op, bool withImag >
+    void genericSplitLanes( const LaneSeeds & seeds, const Master & m, double * pRe, double * pIm, size_t numLanes,
+                            double scalar, const double * pScalars, size_t n )
+    {
+        for ( size_t k = 0; numLanes != k; ++k )
+        {
+            emitComponent< op >( pRe[ k ], deriveLaneReal( seeds, m, k ), scalar, pScalars, n + k );
+            if ( withImag )
+                emitComponent< op >( pIm[ k ], deriveLaneImag( seeds, m, k ), scalar, pScalars, n + k );
+        }
+    }
+
+    using LanesFunction = void (*)( const LaneSeeds &, const Master &, double *, size_t,
+                                    double, const double *, size_t );
+
+    using BlocksFunction = void (*)( const LaneSeeds &, Master &, double *, size_t,
+                                     double, const double * );
+
+    using SplitLanesFunction = void (*)( const LaneSeeds &, const Master &, double *, double *, size_t,
+                                         double, const double *, size_t );
+
+    using SplitBlocksFunction = void (*)( const LaneSeeds &, Master &, double *, double *, size_t,
+                                          double, const double * );
+
+    template< FlyingPhasorKernelOp op >
+    void genericBlocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks,
+                        double scalar, const double * pScalars )
+    {
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            genericLanes< op >( seeds, m, pOut + 2 * K * b, K, scalar, pScalars, K * b );
+            advanceMaster( seeds, m );
+        }
+    }
+
+    template< FlyingPhasorKernelOp op, bool withImag >
+    void genericSplitBlocks( const LaneSeeds & seeds, Master & m, double * pRe, double * pIm, size_t numBlocks,
+                             double scalar, const double * pScalars )
+    {
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            genericSplitLanes< op, withImag >( seeds, m, pRe + K * b, withImag ? pIm + K * b : pIm, K,
+                                               scalar, pScalars, K * b );
+            advanceMaster( seeds, m );
+        }
+    }
+
+    constexpr bool isEnveloped( FlyingPhasorKernelOp op )
+    {
+        return FlyingPhasorKernelOp::GetEnveloped == op || FlyingPhasorKernelOp::AccumEnveloped == op;
+    }
+
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+    // AVX2 Kernel. Each 256 bit register holds two interleaved I/Q samples, which is exactly the user buffer
+    // layout. Exact product errors come from FMA, which yields the same bits as the generic kernel's
+    // Dekker products. No shuffles in the inner loop.
+    struct Avx2Master
+    {
+        __m256d hi;     // [ hiRe, hiIm, ... ]
+        __m256d hiSwN;  // [ -hiIm, hiRe, ... ]
+        __m256d lo;     // [ loRe, loIm, ... ]
+        __m256d loSwN;  // [ -loIm, loRe, ... ]
+    };
+
+    __attribute__(( target( "avx2,fma" ) ))
+    inline __m256d deriveLanesAvx2( const Avx2Master & m, const double * pr, const double * pi,
+                                    const double * plr, const double * pli )
+    {
+        const __m256d vpr = _mm256_loadu_pd( pr );
+        const __m256d vpi = _mm256_loadu_pd( pi );
+        const __m256d p1 = _mm256_mul_pd( m.hi, vpr );
+        const __m256d e1 = _mm256_fmsub_pd( m.hi, vpr, p1 );
+        const __m256d p2 = _mm256_mul_pd( m.hiSwN, vpi );
+        const __m256d e2 = _mm256_fmsub_pd( m.hiSwN, vpi, p2 );
+        const __m256d s = _mm256_add_pd( p1, p2 );
+        const __m256d b = _mm256_sub_pd( s, p1 );
+        const __m256d es = _mm256_add_pd( _mm256_sub_pd( p1, _mm256_sub_pd( s, b ) ), _mm256_sub_pd( p2, b ) );
+        const __m256d c = _mm256_add_pd(
+                _mm256_add_pd( _mm256_mul_pd( m.hi, _mm256_loadu_pd( plr ) ), _mm256_mul_pd( m.hiSwN, _mm256_loadu_pd( pli ) ) ),
+                _mm256_add_pd( _mm256_mul_pd( m.lo, vpr ), _mm256_mul_pd( m.loSwN, vpi ) ) );
+        return _mm256_add_pd( s, _mm256_add_pd( _mm256_add_pd( _mm256_add_pd( es, e1 ), e2 ), c ) );
+    }
+
+    // The scale is either the scalar broadcast or, for the enveloped operations, the envelope lined up with the lanes.
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx2,fma" ) ))
+    inline void emitAvx2( double * pOut, __m256d lane, __m256d scale )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                _mm256_storeu_pd( pOut, lane );
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+            case FlyingPhasorKernelOp::GetEnveloped:
+                _mm256_storeu_pd( pOut, _mm256_mul_pd( lane, scale ) );
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                _mm256_storeu_pd( pOut, _mm256_add_pd( _mm256_loadu_pd( pOut ), lane ) );
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+            case FlyingPhasorKernelOp::AccumEnveloped:
+                _mm256_storeu_pd( pOut, _mm256_add_pd( _mm256_loadu_pd( pOut ), _mm256_mul_pd( lane, scale ) ) );
+                break;
+        }
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx2,fma" ) ))
+    void avx2Blocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks,
+                     double scalar, const double * pScalars )
+    {
+        constexpr size_t V = K / 2;
+        const __m256d sc = _mm256_set1_pd( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx2Master vm{ _mm256_set_pd( m.hiIm, m.hiRe, m.hiIm, m.hiRe ),
+                                 _mm256_set_pd( m.hiRe, -m.hiIm, m.hiRe, -m.hiIm ),
+                                 _mm256_set_pd( m.loIm, m.loRe, m.loIm, m.loRe ),
+                                 _mm256_set_pd( m.loRe, -m.loIm, m.loRe, -m.loIm ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m256d lane = deriveLanesAvx2( vm, seeds.powReDup + 4 * v, seeds.powImDup + 4 * v,
+                                                      seeds.powLoReDup + 4 * v, seeds.powLoImDup + 4 * v );
+                // [ s0, s0, s1, s1 ]
+                const __m256d scale = isEnveloped( op ) ?
+                        _mm256_permute4x64_pd( _mm256_castpd128_pd256( _mm_loadu_pd( pScalars + 2 * v ) ), 0x50 ) : sc;
+                emitAvx2< op >( pOut + 4 * v, lane, scale );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+    }
+
+    // Streaming AVX2 kernel. The Get operation with non-temporal stores, which must be 32 byte aligned. A buffer
+    // that is only 16 byte aligned (Shifted) is streamed from one sample in, each store made up of the upper
+    // sample of one register and the lower sample of the next. The odd samples at either end are stored normally.
+    // The caller issues the store fence.
+    template< bool Shifted >
+    __attribute__(( target( "avx2,fma" ) ))
+    void avx2StreamBlocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks )
+    {
+        constexpr size_t V = K / 2;
+        __m256d prev = _mm256_setzero_pd();
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx2Master vm{ _mm256_set_pd( m.hiIm, m.hiRe, m.hiIm, m.hiRe ),
+                                 _mm256_set_pd( m.hiRe, -m.hiIm, m.hiRe, -m.hiIm ),
+                                 _mm256_set_pd( m.loIm, m.loRe, m.loIm, m.loRe ),
+                                 _mm256_set_pd( m.loRe, -m.loIm, m.loRe, -m.loIm ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m256d lane = deriveLanesAvx2( vm, seeds.powReDup + 4 * v, seeds.powImDup + 4 * v,
+                                                      seeds.powLoReDup + 4 * v, seeds.powLoImDup + 4 * v );
+                if ( !Shifted )
+                    _mm256_stream_pd( pOut + 4 * v, lane );
+                else if ( 0 == b && 0 == v )
+                    _mm_storeu_pd( pOut, _mm256_castpd256_pd128( lane ) );
+                else
+                    _mm256_stream_pd( pOut + 4 * v - 2, _mm256_permute2f128_pd( prev, lane, 0x21 ) );
+                prev = lane;
+            }
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+
+        if ( Shifted && 0 != numBlocks )
+            _mm_storeu_pd( pOut - 2, _mm256_extractf128_pd( prev, 1 ) );
+    }
+
+    __attribute__(( target( "avx2,fma" ) ))
+    void avx2StreamBlocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks,
+                           double, const double * )
+    {
+        if ( 0 == reinterpret_cast< std::uintptr_t >( pOut ) % 32 )
+            avx2StreamBlocks< false >( seeds, m, pOut, numBlocks );
+        else
+            avx2StreamBlocks< true >( seeds, m, pOut, numBlocks );
+        _mm_sfence();
+    }
+
+    // Split plane AVX2 kernel. Each register holds four consecutive real or imaginary components, which is
+    // exactly the layout of the undup'ed seeds. The master is broadcast, with the roles of its components
+    // arranged so that deriveLanesAvx2 performs the very operations deriveLane does for each plane. Without
+    // the imaginary plane (real only), only the real components are derived.
+    template< FlyingPhasorKernelOp op, bool withImag >
+    __attribute__(( target( "avx2,fma" ) ))
+    void avx2SplitBlocks( const LaneSeeds & seeds, Master & m, double * pRe, double * pIm, size_t numBlocks,
+                          double scalar, const double * pScalars )
+    {
+        constexpr size_t V = K / 4;
+        const __m256d sc = _mm256_set1_pd( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            // Real: hiRe * pRe + (-hiIm) * pIm. Imaginary: hiIm * pRe + hiRe * pIm.
+            const Avx2Master vmRe{ _mm256_set1_pd( m.hiRe ), _mm256_set1_pd( -m.hiIm ),
+                                   _mm256_set1_pd( m.loRe ), _mm256_set1_pd( -m.loIm ) };
+            const Avx2Master vmIm{ _mm256_set1_pd( m.hiIm ), _mm256_set1_pd( m.hiRe ),
+                                   _mm256_set1_pd( m.loIm ), _mm256_set1_pd( m.loRe ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m256d scale = isEnveloped( op ) ? _mm256_loadu_pd( pScalars + 4 * v ) : sc;
+                emitAvx2< op >( pRe + 4 * v, deriveLanesAvx2( vmRe, seeds.powRe + 4 * v, seeds.powIm + 4 * v,
+                                                              seeds.powLoRe + 4 * v, seeds.powLoIm + 4 * v ), scale );
+                if ( withImag )
+                    emitAvx2< op >( pIm + 4 * v, deriveLanesAvx2( vmIm, seeds.powRe + 4 * v, seeds.powIm + 4 * v,
+                                                                  seeds.powLoRe + 4 * v, seeds.powLoIm + 4 * v ), scale );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pRe += K;
+            if ( withImag )
+                pIm += K;
+            advanceMaster( seeds, m );
+        }
+    }
+
+    // AVX-512F Kernel. Four interleaved I/Q samples per register. Otherwise, identical to the AVX2 kernel.
+    struct Avx512Master
+    {
+        __m512d hi;
+        __m512d hiSwN;
+        __m512d lo;
+        __m512d loSwN;
+    };
+
+    __attribute__(( target( "avx512f,fma" ) ))
+    inline __m512d deriveLanesAvx512( const Avx512Master & m, const double * pr, const double * pi,
+                                      const double * plr, const double * pli )
+    {
+        const __m512d vpr = _mm512_loadu_pd( pr );
+        const __m512d vpi = _mm512_loadu_pd( pi );
+        const __m512d p1 = _mm512_mul_pd( m.hi, vpr );
+        const __m512d e1 = _mm512_fmsub_pd( m.hi, vpr, p1 );
+        const __m512d p2 = _mm512_mul_pd( m.hiSwN, vpi );
+        const __m512d e2 = _mm512_fmsub_pd( m.hiSwN, vpi, p2 );
+        const __m512d s = _mm512_add_pd( p1, p2 );
+        const __m512d b = _mm512_sub_pd( s, p1 );
+        const __m512d es = _mm512_add_pd( _mm512_sub_pd( p1, _mm512_sub_pd( s, b ) ), _mm512_sub_pd( p2, b ) );
+        const __m512d c = _mm512_add_pd(
+                _mm512_add_pd( _mm512_mul_pd( m.hi, _mm512_loadu_pd( plr ) ), _mm512_mul_pd( m.hiSwN, _mm512_loadu_pd( pli ) ) ),
+                _mm512_add_pd( _mm512_mul_pd( m.lo, vpr ), _mm512_mul_pd( m.loSwN, vpi ) ) );
+        return _mm512_add_pd( s, _mm512_add_pd( _mm512_add_pd( _mm512_add_pd( es, e1 ), e2 ), c ) );
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx512f,fma" ) ))
+    inline void emitAvx512( double * pOut, __m512d lane, __m512d scale )
+    {
+        switch ( op )
+        {
+            case FlyingPhasorKernelOp::Get:
+                _mm512_storeu_pd( pOut, lane );
+                break;
+            case FlyingPhasorKernelOp::GetScaled:
+            case FlyingPhasorKernelOp::GetEnveloped:
+                _mm512_storeu_pd( pOut, _mm512_mul_pd( lane, scale ) );
+                break;
+            case FlyingPhasorKernelOp::Accum:
+                _mm512_storeu_pd( pOut, _mm512_add_pd( _mm512_loadu_pd( pOut ), lane ) );
+                break;
+            case FlyingPhasorKernelOp::AccumScaled:
+            case FlyingPhasorKernelOp::AccumEnveloped:
+                _mm512_storeu_pd( pOut, _mm512_add_pd( _mm512_loadu_pd( pOut ), _mm512_mul_pd( lane, scale ) ) );
+                break;
+        }
+    }
+
+    template< FlyingPhasorKernelOp op >
+    __attribute__(( target( "avx512f,fma" ) ))
+    void avx512Blocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks,
+                       double scalar, const double * pScalars )
+    {
+        constexpr size_t V = K / 4;
+        const __m512d sc = _mm512_set1_pd( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx512Master vm{
+                    _mm512_set_pd( m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe ),
+                    _mm512_set_pd( m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm ),
+                    _mm512_set_pd( m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe ),
+                    _mm512_set_pd( m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m512d lane = deriveLanesAvx512( vm, seeds.powReDup + 8 * v, seeds.powImDup + 8 * v,
+                                                        seeds.powLoReDup + 8 * v, seeds.powLoImDup + 8 * v );
+                // [ s0, s0, s1, s1, s2, s2, s3, s3 ]
+                const __m512d scale = isEnveloped( op ) ?
+                        _mm512_maskz_permutexvar_pd( 0xFF, _mm512_set_epi64( 3, 3, 2, 2, 1, 1, 0, 0 ),
+                                                     _mm512_maskz_loadu_pd( 0x0F, pScalars + 4 * v ) ) : sc;
+                emitAvx512< op >( pOut + 8 * v, lane, scale );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+    }
+
+    // Streaming AVX-512F kernel. As the streaming AVX2 kernel, except that non-temporal stores must be 64 byte
+    // aligned and so, a 16 byte aligned buffer may be Shift (0 to 3) samples past a line boundary. Each store is
+    // then made up of the upper samples of one register and the lower samples of the next. The partial lines at
+    // either end are stored normally, with masked stores.
+    template< unsigned int Shift >
+    __attribute__(( target( "avx512f,fma" ) ))
+    void avx512StreamBlocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks )
+    {
+        constexpr size_t V = K / 4;
+        constexpr int carry = 2 * Shift;        // Doubles of one register that spill into the next line.
+        __m512d prev = _mm512_setzero_pd();
+
+        // Selects the last 'carry' doubles of the previous register followed by the first of the next.
+        const __m512i join = _mm512_set_epi64( 15 - carry, 14 - carry, 13 - carry, 12 - carry,
+                                               11 - carry, 10 - carry, 9 - carry, 8 - carry );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx512Master vm{
+                    _mm512_set_pd( m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe, m.hiIm, m.hiRe ),
+                    _mm512_set_pd( m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm, m.hiRe, -m.hiIm ),
+                    _mm512_set_pd( m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe, m.loIm, m.loRe ),
+                    _mm512_set_pd( m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm, m.loRe, -m.loIm ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m512d lane = deriveLanesAvx512( vm, seeds.powReDup + 8 * v, seeds.powImDup + 8 * v,
+                                                        seeds.powLoReDup + 8 * v, seeds.powLoImDup + 8 * v );
+                if ( 0 == Shift )
+                    _mm512_stream_pd( pOut + 8 * v, lane );
+                else if ( 0 == b && 0 == v )
+                    _mm512_mask_storeu_pd( pOut, __mmask8( ( 1 << ( 8 - carry ) ) - 1 ), lane );
+                else
+                    _mm512_stream_pd( pOut + 8 * v - carry, _mm512_permutex2var_pd( prev, join, lane ) );
+                prev = lane;
+            }
+            pOut += 2 * K;
+            advanceMaster( seeds, m );
+        }
+
+        if ( 0 != Shift && 0 != numBlocks )
+            _mm512_mask_storeu_pd( pOut - 8, __mmask8( 0xFF << ( 8 - carry ) ), prev );
+    }
+
+    __attribute__(( target( "avx512f,fma" ) ))
+    void avx512StreamBlocks( const LaneSeeds & seeds, Master & m, double * pOut, size_t numBlocks,
+                             double, const double * )
+    {
+        switch ( reinterpret_cast< std::uintptr_t >( pOut ) % 64 / 16 )
+        {
+            case 0: avx512StreamBlocks< 0 >( seeds, m, pOut, numBlocks ); break;
+            case 1: avx512StreamBlocks< 1 >( seeds, m, pOut, numBlocks ); break;
+            case 2: avx512StreamBlocks< 2 >( seeds, m, pOut, numBlocks ); break;
+            default: avx512StreamBlocks< 3 >( seeds, m, pOut, numBlocks ); break;
+        }
+        _mm_sfence();
+    }
+
+    // Split plane AVX-512F kernel. Eight real or imaginary components per register. Otherwise, identical
+    // to the split plane AVX2 kernel.
+    template< FlyingPhasorKernelOp op, bool withImag >
+    __attribute__(( target( "avx512f,fma" ) ))
+    void avx512SplitBlocks( const LaneSeeds & seeds, Master & m, double * pRe, double * pIm, size_t numBlocks,
+                            double scalar, const double * pScalars )
+    {
+        constexpr size_t V = K / 8;
+        const __m512d sc = _mm512_set1_pd( scalar );
+
+        for ( size_t b = 0; numBlocks != b; ++b )
+        {
+            const Avx512Master vmRe{ _mm512_set1_pd( m.hiRe ), _mm512_set1_pd( -m.hiIm ),
+                                     _mm512_set1_pd( m.loRe ), _mm512_set1_pd( -m.loIm ) };
+            const Avx512Master vmIm{ _mm512_set1_pd( m.hiIm ), _mm512_set1_pd( m.hiRe ),
+                                     _mm512_set1_pd( m.loIm ), _mm512_set1_pd( m.loRe ) };
+            for ( size_t v = 0; V != v; ++v )
+            {
+                const __m512d scale = isEnveloped( op ) ? _mm512_loadu_pd( pScalars + 8 * v ) : sc;
+                emitAvx512< op >( pRe + 8 * v, deriveLanesAvx512( vmRe, seeds.powRe + 8 * v, seeds.powIm + 8 * v,
+                                                                  seeds.powLoRe + 8 * v, seeds.powLoIm + 8 * v ), scale );
+                if ( withImag )
+                    emitAvx512< op >( pIm + 8 * v, deriveLanesAvx512( vmIm, seeds.powRe + 8 * v, seeds.powIm + 8 * v,
+                                                                      seeds.powLoRe + 8 * v, seeds.powLoIm + 8 * v ), scale );
+            }
+            if ( isEnveloped( op ) )
+                pScalars += K;
+            pRe += K;
+            if ( withImag )
+                pIm += K;
+            advanceMaster( seeds, m );
+        }
+    }
+#endif
+
+    struct KernelTable
+    {
+        const char * name;
+        BlocksFunction blocks[ 6 ];
+        SplitBlocksFunction splitBlocks[ 6 ];
+        SplitBlocksFunction realBlocks[ 6 ];
+        BlocksFunction streamBlocks;
+    };
+
+    const LanesFunction genericLanesTable[ 6 ] = {
+            genericLanes< FlyingPhasorKernelOp::Get >,
+            genericLanes< FlyingPhasorKernelOp::GetScaled >,
+            genericLanes< FlyingPhasorKernelOp::GetEnveloped >,
+            genericLanes< FlyingPhasorKernelOp::Accum >,
+            genericLanes< FlyingPhasorKernelOp::AccumScaled >,
+            genericLanes< FlyingPhasorKernelOp::AccumEnveloped >
+    };
+
+    const SplitLanesFunction genericSplitLanesTable[ 6 ] = {
+            genericSplitLanes< FlyingPhasorKernelOp::Get, true >,
+            genericSplitLanes< FlyingPhasorKernelOp::GetScaled, true >,
+            genericSplitLanes< FlyingPhasorKernelOp::GetEnveloped, true >,
+            genericSplitLanes< FlyingPhasorKernelOp::Accum, true >,
+            genericSplitLanes< FlyingPhasorKernelOp::AccumScaled, true >,
+            genericSplitLanes< FlyingPhasorKernelOp::AccumEnveloped, true >
+    };
+
+    const SplitLanesFunction genericRealLanesTable[ 6 ] = {
+            genericSplitLanes< FlyingPhasorKernelOp::Get, false >,
+            genericSplitLanes< FlyingPhasorKernelOp::GetScaled, false >,
+            genericSplitLanes< FlyingPhasorKernelOp::GetEnveloped, false >,
+            genericSplitLanes< FlyingPhasorKernelOp::Accum, false >,
+            genericSplitLanes< FlyingPhasorKernelOp::AccumScaled, false >,
+            genericSplitLanes< FlyingPhasorKernelOp::AccumEnveloped, false >
+    };
+
+    const KernelTable genericKernel = {
+            "generic",
+            {
+                genericBlocks< FlyingPhasorKernelOp::Get >,
+                genericBlocks< FlyingPhasorKernelOp::GetScaled >,
+                genericBlocks< FlyingPhasorKernelOp::GetEnveloped >,
+                genericBlocks< FlyingPhasorKernelOp::Accum >,
+                genericBlocks< FlyingPhasorKernelOp::AccumScaled >,
+                genericBlocks< FlyingPhasorKernelOp::AccumEnveloped >
+            },
+            {
+                genericSplitBlocks< FlyingPhasorKernelOp::Get, true >,
+                genericSplitBlocks< FlyingPhasorKernelOp::GetScaled, true >,
+                genericSplitBlocks< FlyingPhasorKernelOp::GetEnveloped, true >,
+                genericSplitBlocks< FlyingPhasorKernelOp::Accum, true >,
+                genericSplitBlocks< FlyingPhasorKernelOp::AccumScaled, true >,
+                genericSplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, true >
+            },
+            {
+                genericSplitBlocks< FlyingPhasorKernelOp::Get, false >,
+                genericSplitBlocks< FlyingPhasorKernelOp::GetScaled, false >,
+                genericSplitBlocks< FlyingPhasorKernelOp::GetEnveloped, false >,
+                genericSplitBlocks< FlyingPhasorKernelOp::Accum, false >,
+                genericSplitBlocks< FlyingPhasorKernelOp::AccumScaled, false >,
+                genericSplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, false >
+            },
+            // The portable kernel has no non-temporal stores. It stores normally.
+            genericBlocks< FlyingPhasorKernelOp::Get >
+    };
+
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+    const KernelTable avx2Kernel = {
+            "avx2",
+            {
+                avx2Blocks< FlyingPhasorKernelOp::Get >,
+                avx2Blocks< FlyingPhasorKernelOp::GetScaled >,
+                avx2Blocks< FlyingPhasorKernelOp::GetEnveloped >,
+                avx2Blocks< FlyingPhasorKernelOp::Accum >,
+                avx2Blocks< FlyingPhasorKernelOp::AccumScaled >,
+                avx2Blocks< FlyingPhasorKernelOp::AccumEnveloped >
+            },
+            {
+                avx2SplitBlocks< FlyingPhasorKernelOp::Get, true >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::GetScaled, true >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::GetEnveloped, true >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::Accum, true >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::AccumScaled, true >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, true >
+            },
+            {
+                avx2SplitBlocks< FlyingPhasorKernelOp::Get, false >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::GetScaled, false >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::GetEnveloped, false >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::Accum, false >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::AccumScaled, false >,
+                avx2SplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, false >
+            },
+            avx2StreamBlocks
+    };
+
+    const KernelTable avx512Kernel = {
+            "avx512f",
+            {
+                avx512Blocks< FlyingPhasorKernelOp::Get >,
+                avx512Blocks< FlyingPhasorKernelOp::GetScaled >,
+                avx512Blocks< FlyingPhasorKernelOp::GetEnveloped >,
+                avx512Blocks< FlyingPhasorKernelOp::Accum >,
+                avx512Blocks< FlyingPhasorKernelOp::AccumScaled >,
+                avx512Blocks< FlyingPhasorKernelOp::AccumEnveloped >
+            },
+            {
+                avx512SplitBlocks< FlyingPhasorKernelOp::Get, true >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::GetScaled, true >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::GetEnveloped, true >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::Accum, true >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::AccumScaled, true >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, true >
+            },
+            {
+                avx512SplitBlocks< FlyingPhasorKernelOp::Get, false >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::GetScaled, false >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::GetEnveloped, false >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::Accum, false >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::AccumScaled, false >,
+                avx512SplitBlocks< FlyingPhasorKernelOp::AccumEnveloped, false >
+            },
+            avx512StreamBlocks
+    };
+#endif
+
+    bool isKernelOverride( const char * pName )
+    {
+        const char * pOverride = std::getenv( "REISER_RT_FLYING_PHASOR_KERNEL" );
+        return pOverride && 0 == std::strcmp( pOverride, pName );
+    }
+
+    FlyingPhasorKernelIsa resolveIsa()
+    {
+        // An override may only select downward. We never run code the CPU cannot execute.
+        if ( isKernelOverride( "generic" ) )
+            return FlyingPhasorKernelIsa::Generic;
+
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+        __builtin_cpu_init();
+        if ( !__builtin_cpu_supports( "fma" ) )
+            return FlyingPhasorKernelIsa::Generic;
+        const bool noAvx512 = isKernelOverride( "avx2" );
+        if ( !noAvx512 && __builtin_cpu_supports( "avx512f" ) )
+            return FlyingPhasorKernelIsa::Avx512f;
+        if ( __builtin_cpu_supports( "avx2" ) )
+            return FlyingPhasorKernelIsa::Avx2;
+#endif
+        return FlyingPhasorKernelIsa::Generic;
+    }
+
+    const KernelTable & selectedKernel()
+    {
+        switch ( flyingPhasorKernelIsa() )
+        {
+#if REISER_RT_FLYING_PHASOR_X86_KERNELS
+            case FlyingPhasorKernelIsa::Avx512f: return avx512Kernel;
+            case FlyingPhasorKernelIsa::Avx2: return avx2Kernel;
+#endif
+            default: return genericKernel;
+        }
+    }
+}
+
+FlyingPhasorKernelIsa Detail::flyingPhasorKernelIsa()
+{
+    // Resolved once, on first use. Static local initialization is thread safe since C++11.
+    static const FlyingPhasorKernelIsa isa = resolveIsa();
+    return isa;
+}
+
+bool Detail::flyingPhasorUseKernel( size_t numSamples )
+{
+    // The generic kernel is not selected for speed but only when forced, as a reference.
+    static const bool enabled = FlyingPhasorKernelIsa::Generic != flyingPhasorKernelIsa() ||
+                                isKernelOverride( "generic" );
+    return enabled && flyingPhasorKernelThreshold <= numSamples;
+}
+
+void Detail::flyingPhasorKernelBlocks( FlyingPhasorKernelOp op, const FlyingPhasorLaneSeeds & seeds,
+                                       FlyingPhasorMaster & master,
+                                       FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numBlocks,
+                                       double scalar, const double * pScalars )
+{
+    // The std::complex array-oriented access guarantee (C++11 26.4) lets us treat the buffer as interleaved doubles.
+    auto pOut = reinterpret_cast< double * >( pElementBuffer );
+    selectedKernel().blocks[ int( op ) ]( seeds, master, pOut, numBlocks, scalar, pScalars );
+}
+
+FlyingPhasorElementType Detail::flyingPhasorKernelTail( FlyingPhasorKernelOp op,
+                                                        const FlyingPhasorLaneSeeds & seeds,
+                                                        const FlyingPhasorMaster & master,
+                                                        FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                        size_t numSamples,
+                                                        double scalar, const double * pScalars )
+{
+    auto pOut = reinterpret_cast< double * >( pElementBuffer );
+    genericLanesTable[ int( op ) ]( seeds, master, pOut, numSamples, scalar, pScalars, 0 );
+
+    // The next sample is simply the next lane.
+    double re, im;
+    deriveLane( seeds, master, numSamples, re, im );
+    return FlyingPhasorElementType{ re, im };
+}
+
+FlyingPhasorElementType Detail::flyingPhasorKernel( FlyingPhasorKernelOp op,
+                                                    const FlyingPhasorElementType & phasor,
+                                                    const FlyingPhasorElementType & rate,
+                                                    FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                    size_t numSamples,
+                                                    double scalar, const double * pScalars )
+{
+    FlyingPhasorLaneSeeds seeds;
+    flyingPhasorSeedLanes( rate, seeds );
+    FlyingPhasorMaster master{ phasor };
+
+    // Whole blocks first, by whichever kernel was selected. Then, whatever partial block remains.
+    const size_t numBlocks = numSamples / K;
+    flyingPhasorKernelBlocks( op, seeds, master, pElementBuffer, numBlocks, scalar, pScalars );
+
+    const size_t done = numBlocks * K;
+    return flyingPhasorKernelTail( op, seeds, master, pElementBuffer + done, numSamples - done,
+                                   scalar, pScalars ? pScalars + done : nullptr );
+}
+
+FlyingPhasorElementType Detail::flyingPhasorSplitKernel( FlyingPhasorKernelOp op,
+                                                         const FlyingPhasorElementType & phasor,
+                                                         const FlyingPhasorElementType & rate,
+                                                         FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                         FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                                         size_t numSamples,
+                                                         double scalar, const double * pScalars )
+{
+    FlyingPhasorLaneSeeds seeds;
+    flyingPhasorSeedLanes( rate, seeds );
+    FlyingPhasorMaster master{ phasor };
+
+    const size_t numBlocks = numSamples / K;
+    selectedKernel().splitBlocks[ int( op ) ]( seeds, master, pRealBuffer, pImagBuffer, numBlocks, scalar, pScalars );
+
+    const size_t done = numBlocks * K;
+    genericSplitLanesTable[ int( op ) ]( seeds, master, pRealBuffer + done, pImagBuffer + done, numSamples - done,
+                                         scalar, pScalars ? pScalars + done : nullptr, 0 );
+
+    double re, im;
+    deriveLane( seeds, master, numSamples - done, re, im );
+    return FlyingPhasorElementType{ re, im };
+}
+
+FlyingPhasorElementType Detail::flyingPhasorRealKernel( FlyingPhasorKernelOp op,
+                                                        const FlyingPhasorElementType & phasor,
+                                                        const FlyingPhasorElementType & rate,
+                                                        FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                        size_t numSamples,
+                                                        double scalar, const double * pScalars )
+{
+    FlyingPhasorLaneSeeds seeds;
+    flyingPhasorSeedLanes( rate, seeds );
+    FlyingPhasorMaster master{ phasor };
+
+    const size_t numBlocks = numSamples / K;
+    selectedKernel().realBlocks[ int( op ) ]( seeds, master, pRealBuffer, nullptr, numBlocks, scalar, pScalars );
+
+    const size_t done = numBlocks * K;
+    genericRealLanesTable[ int( op ) ]( seeds, master, pRealBuffer + done, nullptr, numSamples - done,
+                                        scalar, pScalars ? pScalars + done : nullptr, 0 );
+
+    double re, im;
+    deriveLane( seeds, master, numSamples - done, re, im );
+    return FlyingPhasorElementType{ re, im };
+}
+
+FlyingPhasorElementType Detail::flyingPhasorStreamKernel( const FlyingPhasorElementType & phasor,
+                                                          const FlyingPhasorElementType & rate,
+                                                          FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                          size_t numSamples )
+{
+    FlyingPhasorLaneSeeds seeds;
+    flyingPhasorSeedLanes( rate, seeds );
+    FlyingPhasorMaster master{ phasor };
+
+    // Whole blocks streamed, by whichever kernel was selected. Then, whatever partial block remains, normally.
+    auto pOut = reinterpret_cast< double * >( pElementBuffer );
+    const size_t numBlocks = numSamples / K;
+    selectedKernel().streamBlocks( seeds, master, pOut, numBlocks, 1.0, nullptr );
+
+    const size_t done = numBlocks * K;
+    return flyingPhasorKernelTail( FlyingPhasorKernelOp::Get, seeds, master, pElementBuffer + done,
+                                   numSamples - done, 1.0, nullptr );
+}
+
+const char * Detail::flyingPhasorKernelName()
+{
+    return selectedKernel().name;
+}
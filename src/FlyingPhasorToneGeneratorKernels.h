@@ -0,0 +1,377 @@
+/**
+ * @file FlyingPhasorToneGeneratorKernels.h
+ * @brief The Private Specification file for the Flying Phasor Multi-Lane Kernels
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#ifndef REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORKERNELS_H
+#define REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORKERNELS_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        namespace Detail
+        {
+            /**
+             * @brief Number of Lanes
+             *
+             * The multi-lane kernels produce this many samples per block. Each block is derived
+             * from a single master phasor which is advanced by rate^K once per block.
+             */
+            constexpr size_t flyingPhasorLaneCount = 32;
+
+            /**
+             * @brief Kernel Threshold
+             *
+             * Requests smaller than this are serviced by the serial loops. Seeding the lanes has a fixed cost
+             * that is not worth paying for a handful of samples.
+             */
+            constexpr size_t flyingPhasorKernelThreshold = 4 * flyingPhasorLaneCount;
+
+            /**
+             * @brief Scratch Chunk Size
+             *
+             * Operations that generate samples into a scratch buffer of their own before working them into the
+             * user's (converting, mixing, modulating or filtering) do so this many samples at a time. 512 samples
+             * is 8KB, small enough for the stack and the L1 data cache, yet enough for the kernels to service.
+             */
+            constexpr size_t flyingPhasorScratchChunkSize = 512;
+
+            /**
+             * @brief Use Kernel Query
+             *
+             * This operation returns true if a request of numSamples is to be serviced by the multi-lane kernels
+             * rather than the serial loops. Requests smaller than flyingPhasorKernelThreshold never are and, where
+             * no SIMD kernel is available for the running CPU (or the compiler), none are. Without FMA, the generic
+             * kernel's exact products cost more than breaking up the serial chain saves. It then only runs when
+             * forced by REISER_RT_FLYING_PHASOR_KERNEL, as the bit for bit reference for the SIMD kernels.
+             *
+             * @param numSamples The number of samples requested.
+             *
+             * @return Returns true if the request is to be serviced by the multi-lane kernels.
+             */
+            bool flyingPhasorUseKernel( size_t numSamples );
+
+            /**
+             * @brief Kernel Operation
+             *
+             * Identifies which of the six bulk operations a kernel invocation is to perform on the user buffer.
+             */
+            enum class FlyingPhasorKernelOp : int
+            {
+                Get=0, GetScaled, GetEnveloped, Accum, AccumScaled, AccumEnveloped
+            };
+
+            /**
+             * @brief Kernel Instruction Set
+             *
+             * Identifies the instruction set the kernels were selected for.
+             */
+            enum class FlyingPhasorKernelIsa : int
+            {
+                Generic=0, Avx2, Avx512f
+            };
+
+            /**
+             * @brief Lane Seeds
+             *
+             * Everything the kernels need to know about a rate phasor. It depends upon the rate alone and so,
+             * may be computed once and reused for as long as the rate does not change.
+             */
+            struct FlyingPhasorLaneSeeds
+            {
+                // The powers rate^k for k in [0, K), rounded to double, plus the residuals that rounding discarded.
+                double powRe[ flyingPhasorLaneCount ];
+                double powIm[ flyingPhasorLaneCount ];
+                double powLoRe[ flyingPhasorLaneCount ];
+                double powLoIm[ flyingPhasorLaneCount ];
+
+                // The rounded powers split in halves for the generic kernel's exact products.
+                double powReHi[ flyingPhasorLaneCount ];
+                double powReLo[ flyingPhasorLaneCount ];
+                double powImHi[ flyingPhasorLaneCount ];
+                double powImLo[ flyingPhasorLaneCount ];
+
+                // The powers and residuals with each element duplicated. The interleaved SIMD kernels want
+                // real and imaginary parts of a single power in adjacent slots, so they line up with
+                // interleaved I/Q sample pairs.
+                double powReDup[ 2 * flyingPhasorLaneCount ];
+                double powImDup[ 2 * flyingPhasorLaneCount ];
+                double powLoReDup[ 2 * flyingPhasorLaneCount ];
+                double powLoImDup[ 2 * flyingPhasorLaneCount ];
+
+                // rate^K. The master is advanced in extended precision.
+                long double stepRe;
+                long double stepIm;
+            };
+
+            /**
+             * @brief The Master Phasor
+             *
+             * The kernel state that carries from one block to the next. It is carried in extended precision and
+             * made available to the lanes as a rounded double (hi) plus the residual that rounding discarded (lo).
+             */
+            struct FlyingPhasorMaster
+            {
+                explicit FlyingPhasorMaster( const FlyingPhasorElementType & phasor );
+
+                void refresh();
+
+                long double re;
+                long double im;
+
+                double hiRe;
+                double hiIm;
+                double loRe;
+                double loIm;
+
+                // The rounded master split in halves for the generic kernel's exact products.
+                double hiReHi;
+                double hiReLo;
+                double hiImHi;
+                double hiImLo;
+            };
+
+            /**
+             * @brief Seed Lanes Operation
+             *
+             * This operation computes the lane seeds for a rate phasor.
+             *
+             * @param rate The per sample rate phasor.
+             * @param seeds The lane seeds to be computed.
+             */
+            void flyingPhasorSeedLanes( const FlyingPhasorElementType & rate, FlyingPhasorLaneSeeds & seeds );
+
+            /**
+             * @brief Kernel Blocks Operation
+             *
+             * This operation delivers whole blocks of flyingPhasorLaneCount samples into the user buffer according
+             * to the operation specified, advancing the master as it goes. It is the building block of
+             * flyingPhasorKernel for clients which must interleave the work of several tones.
+             *
+             * @param op The operation to be performed on the user buffer.
+             * @param seeds The lane seeds for the rate phasor.
+             * @param master The master phasor, advanced by the number of blocks delivered.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of blocks.
+             * @param numBlocks The number of blocks to be delivered.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             */
+            void flyingPhasorKernelBlocks( FlyingPhasorKernelOp op, const FlyingPhasorLaneSeeds & seeds,
+                                           FlyingPhasorMaster & master,
+                                           FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numBlocks,
+                                           double scalar, const double * pScalars );
+
+            /**
+             * @brief Kernel Tail Operation
+             *
+             * This operation delivers a partial block of fewer than flyingPhasorLaneCount samples and
+             * completes the work started by flyingPhasorKernelBlocks.
+             *
+             * @param op The operation to be performed on the user buffer.
+             * @param seeds The lane seeds for the rate phasor.
+             * @param master The master phasor.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered. Must be less than flyingPhasorLaneCount.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             *
+             * @return Returns the phasor to be delivered as the next sample, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorKernelTail( FlyingPhasorKernelOp op,
+                                                            const FlyingPhasorLaneSeeds & seeds,
+                                                            const FlyingPhasorMaster & master,
+                                                            FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                            size_t numSamples,
+                                                            double scalar, const double * pScalars );
+
+            /**
+             * @brief The Multi-Lane Kernel Operation
+             *
+             * This operation delivers 'N' samples into the user buffer according to the operation specified.
+             * The work is handed off to the best kernel the running CPU supports (AVX-512F, AVX2 or generic).
+             * All kernels perform identical IEEE-754 operations in identical order. Therefore, results are
+             * bit for bit the same no matter which kernel was selected.
+             *
+             * @param op The operation to be performed on the user buffer.
+             * @param phasor The phasor to be delivered as the first sample.
+             * @param rate The per sample rate phasor.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             *
+             * @return Returns the phasor to be delivered as the next sample, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorKernel( FlyingPhasorKernelOp op,
+                                                        const FlyingPhasorElementType & phasor,
+                                                        const FlyingPhasorElementType & rate,
+                                                        FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                        size_t numSamples,
+                                                        double scalar, const double * pScalars );
+
+            /**
+             * @brief The Split Plane Multi-Lane Kernel Operation
+             *
+             * This operation is the split plane counterpart of flyingPhasorKernel. Real and imaginary components
+             * are delivered into separate buffers. The samples are bit for bit those flyingPhasorKernel delivers.
+             *
+             * @param op The operation to be performed on the user buffers.
+             * @param phasor The phasor to be delivered as the first sample.
+             * @param rate The per sample rate phasor.
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param pImagBuffer User provided buffer large enough to hold the requested number of imaginary components.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             *
+             * @return Returns the phasor to be delivered as the next sample, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorSplitKernel( FlyingPhasorKernelOp op,
+                                                             const FlyingPhasorElementType & phasor,
+                                                             const FlyingPhasorElementType & rate,
+                                                             FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                             FlyingPhasorPlaneBufferTypePtr pImagBuffer,
+                                                             size_t numSamples,
+                                                             double scalar, const double * pScalars );
+
+            /**
+             * @brief The Real Only Multi-Lane Kernel Operation
+             *
+             * This operation is the real only counterpart of flyingPhasorSplitKernel. Only the real components are
+             * derived and delivered. They are bit for bit those flyingPhasorSplitKernel delivers into its real plane.
+             *
+             * @param op The operation to be performed on the user buffer.
+             * @param phasor The phasor to be delivered as the first sample.
+             * @param rate The per sample rate phasor.
+             * @param pRealBuffer User provided buffer large enough to hold the requested number of real components.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             *
+             * @return Returns the phasor to be delivered as the next sample, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorRealKernel( FlyingPhasorKernelOp op,
+                                                            const FlyingPhasorElementType & phasor,
+                                                            const FlyingPhasorElementType & rate,
+                                                            FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                            size_t numSamples,
+                                                            double scalar, const double * pScalars );
+
+            /**
+             * @brief The Streaming Multi-Lane Kernel Operation
+             *
+             * This operation delivers 'N' samples into the user buffer as flyingPhasorKernel does for the Get
+             * operation, bit for bit, but with non-temporal stores for whole blocks where the selected kernel
+             * supports them. The portable kernel stores normally.
+             *
+             * @param phasor The phasor to be delivered as the first sample.
+             * @param rate The per sample rate phasor.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * It must be aligned to a whole sample (16 bytes).
+             * @param numSamples The number of samples to be delivered.
+             *
+             * @return Returns the phasor to be delivered as the next sample, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorStreamKernel( const FlyingPhasorElementType & phasor,
+                                                              const FlyingPhasorElementType & rate,
+                                                              FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                              size_t numSamples );
+
+            /**
+             * @brief The Single Precision Multi-Lane Kernel Operation
+             *
+             * This operation is the single precision counterpart of flyingPhasorKernel. The master phasor is
+             * carried in double precision while the lanes are derived in single precision. That doubles the number
+             * of samples per SIMD register. Results are bit for bit the same no matter which kernel was selected.
+             *
+             * @param op The operation to be performed on the user buffer.
+             * @param phasor The phasor to be delivered as the first sample.
+             * @param rate The per sample rate phasor.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param scalar The scalar to be used by the GetScaled and AccumScaled operations.
+             * @param pScalars The vector of scalars to be used by the GetEnveloped and AccumEnveloped operations.
+             *
+             * @return Returns the phasor to be delivered as the next sample, in double precision, normalized.
+             */
+            FlyingPhasorElementType flyingPhasorFloatKernel( FlyingPhasorKernelOp op,
+                                                             const FlyingPhasorElementType & phasor,
+                                                             const FlyingPhasorElementType & rate,
+                                                             FlyingPhasorFloatElementBufferTypePtr pElementBuffer,
+                                                             size_t numSamples,
+                                                             float scalar, const float * pScalars );
+
+            /**
+             * @brief Get Kernel Instruction Set
+             *
+             * This operation returns the instruction set selected for the running CPU. See flyingPhasorKernelName.
+             *
+             * @return Returns the instruction set selected.
+             */
+            FlyingPhasorKernelIsa flyingPhasorKernelIsa();
+
+            /**
+             * @brief Get Kernel Name
+             *
+             * This operation returns the name of the kernel selected for the running CPU.
+             * The selection may be overridden (downward only) by setting the environment variable
+             * REISER_RT_FLYING_PHASOR_KERNEL to one of "generic", "avx2" or "avx512f" prior to first use.
+             *
+             * @return Returns the name of the selected kernel.
+             */
+            const char * flyingPhasorKernelName();
+
+            /**
+             * @brief Dither Seed
+             *
+             * This operation returns the seed for the triangular PDF dither of the fixed point operations. It is
+             * formed from the sample counter and rate so, results are repeatable, successive invocations do not
+             * repeat the same dither and, sources at different frequencies do not add identical dither.
+             *
+             * @param sampleCounter The number of samples the source has delivered so far.
+             * @param rate The rate phasor of the source.
+             *
+             * @return Returns the seed for the dither state.
+             */
+            uint64_t flyingPhasorDitherSeed( size_t sampleCounter, const FlyingPhasorElementType & rate );
+
+            /**
+             * @brief Fixed Point Conversion
+             *
+             * This operation scales complex samples into interleaved integer I/Q pairs, optionally accumulating
+             * what the buffer holds, then dithering, rounding half away from zero and saturating. This is
+             * the conversion shared by the SC16 operations of FlyingPhasorToneGenerator and FlyingPhasorToneBank.
+             *
+             * @param pSamples The complex samples to be converted.
+             * @param pIQBuffer The buffer of interleaved I/Q pairs to be converted into.
+             * @param numSamples The number of samples to be converted.
+             * @param gain The finite gain, in integer LSBs, that a unit component maps to.
+             * @param accumulate If true, the scaled samples are added to what the buffer holds before rounding.
+             * @param pDitherState The dither state, advanced as it is used, or nullptr for no dither.
+             */
+            void flyingPhasorConvertFixedPoint( const FlyingPhasorElementType * pSamples,
+                                                FlyingPhasorSC16BufferTypePtr pIQBuffer, size_t numSamples,
+                                                double gain, bool accumulate, uint64_t * pDitherState );
+
+            /**
+             * @brief Fixed Point Conversion
+             *
+             * This operation is the 8 bit counterpart of the above.
+             */
+            void flyingPhasorConvertFixedPoint( const FlyingPhasorElementType * pSamples,
+                                                FlyingPhasorSC8BufferTypePtr pIQBuffer, size_t numSamples,
+                                                double gain, bool accumulate, uint64_t * pDitherState );
+        }
+    }
+}
+
+#endif //REISERRT_FLYINGPHASOR_FLYINGPHASORTONEGENERATORKERNELS_H
@@ -0,0 +1,63 @@
+/**
+ * @file FlyingPhasorToneGeneratorMix.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Mix Operations
+ *
+ * Like the fixed point operations, mixing generates the tone a chunk at a time into a small buffer on the stack,
+ * which stays in L1 cache, and multiplies each chunk against the user's input on its way to the output.
+ * The user's input and output are each visited once and, the user needs no buffer for the tone.
+ * The tone itself comes from getSamples and so, enjoys the multi-lane kernels for all but the smallest requests.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The complex multiply is written out. We have no use for std::complex's handling of infinities
+    // and, the compiler vectorizes this form readily.
+    template< bool conjugate >
+    inline void mix( const FlyingPhasorElementType * pTone, const FlyingPhasorElementType * pIn,
+                     FlyingPhasorElementType * pOut, size_t numSamples )
+    {
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            const double toneRe = pTone[ i ].real();
+            const double toneIm = conjugate ? -pTone[ i ].imag() : pTone[ i ].imag();
+            const double inRe = pIn[ i ].real();
+            const double inIm = pIn[ i ].imag();
+            pOut[ i ] = FlyingPhasorElementType{ inRe * toneRe - inIm * toneIm, inRe * toneIm + inIm * toneRe };
+        }
+    }
+}
+
+void FlyingPhasorToneGenerator::mixSamples( const FlyingPhasorElementType * pInputBuffer,
+                                            FlyingPhasorElementBufferTypePtr pOutputBuffer,
+                                            size_t numSamples, bool conjugate )
+{
+    FlyingPhasorElementType chunk[ Detail::flyingPhasorScratchChunkSize ];
+    while ( numSamples )
+    {
+        const size_t n = std::min( numSamples, Detail::flyingPhasorScratchChunkSize );
+        getSamples( chunk, n );
+        if ( conjugate )
+            mix< true >( chunk, pInputBuffer, pOutputBuffer, n );
+        else
+            mix< false >( chunk, pInputBuffer, pOutputBuffer, n );
+        pInputBuffer += n;
+        pOutputBuffer += n;
+        numSamples -= n;
+    }
+}
+
+void FlyingPhasorToneGenerator::mixSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                            bool conjugate )
+{
+    mixSamples( pElementBuffer, pElementBuffer, numSamples, conjugate );
+}
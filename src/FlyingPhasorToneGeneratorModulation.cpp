@@ -0,0 +1,385 @@
+/**
+ * @file FlyingPhasorToneGeneratorModulation.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Modulation Operations
+ *
+ * Phase modulation multiplies the carrier by an offset phasor exp( j*p(n) ). Rather than evaluate that with
+ * trig functions every sample, we keep an anchor phasor exp( j*a ), formed with std::polar, and multiply it by
+ * exp( j*( p(n) - a ) ). Modulating signals are normally smooth, so p(n) stays close to the anchor for many
+ * samples at a time and, for small angles, a truncated Taylor series of cos and sin is good to within an ULP.
+ * We use terms through the eleventh power, whose truncation error is below 1.3e-16 for angles up to 1/4 radian.
+ * When p(n) strays further than that from the anchor, it becomes the new anchor. Each offset phasor depends
+ * only upon the anchor and p(n), not upon the one before, so no rounding error builds up. We find each run of
+ * samples sharing an anchor first and then, rotate the run in a loop free of branches and of dependencies from
+ * one sample to the next, which the compiler is free to vectorize.
+ *
+ * Frequency modulation is phase modulation in disguise. With the carrier at the rate w0 the generator already
+ * has, instantaneous frequencies w(n) amount to phase offsets p(n) = sum over k < n of ( w(k) - w0 ). Those grow
+ * without bound. So, we generate the carrier a block of the multi-lane kernels at a time and, before each block,
+ * rotate the kernels' master phasor by the offset accrued up to the block's middle sample. Each sample is left
+ * only its offset from that, which for smooth modulation is small, and is rotated by it with a single complex
+ * multiply. We use the shortest series good for the whole block: through the seventh power for offsets up to
+ * 1/64 radian (truncation error below 1e-19), the eleventh up to 1/4. Blocks straying further than that are
+ * rotated as for phase modulation. Rounding error builds up by an ULP or so per block, in the extended precision
+ * master, not per sample. The rotation is limited by floating point throughput, not latency, so it runs with the
+ * vector width of the kernels.
+ *
+ * Requests too small for the kernels, or made where none run, are serviced serially. Each sample's rate phasor
+ * is formed from an anchor by the shorter series and, advances the phasor as getSamples would.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define REISER_RT_FLYING_PHASOR_X86_ROTATION 1
+#if defined( __clang__ )
+#define REISER_RT_FLYING_PHASOR_AVX512_ROTATION_TARGET "avx512f"
+#else
+#define REISER_RT_FLYING_PHASOR_AVX512_ROTATION_TARGET "avx512f,prefer-vector-width=512"
+#endif
+// The rotation loop, and the series, are built for each instruction set by inlining them into functions that
+// target it. GCC declines to inline into those otherwise.
+#define REISER_RT_FLYING_PHASOR_ROTATION_INLINE __attribute__(( always_inline )) inline
+#else
+#define REISER_RT_FLYING_PHASOR_ROTATION_INLINE inline
+#endif
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Angles further than this from the anchor re-anchor.
+    constexpr double maxSmallAngle = 0.25;
+
+    // exp( j*d ) for |d| <= maxSmallAngle, by Taylor series through d^11, in Horner form. We multiply by
+    // reciprocals folded at compile time. Dividing by the constants would be several times slower.
+    REISER_RT_FLYING_PHASOR_ROTATION_INLINE void smallRotation( double d, double & c, double & s )
+    {
+        const double x = d * d;
+        c = 1.0 - x * ( 1.0 / 2.0 ) * ( 1.0 - x * ( 1.0 / 12.0 ) * ( 1.0 - x * ( 1.0 / 30.0 ) *
+            ( 1.0 - x * ( 1.0 / 56.0 ) * ( 1.0 - x * ( 1.0 / 90.0 ) ) ) ) );
+        s = d * ( 1.0 - x * ( 1.0 / 6.0 ) * ( 1.0 - x * ( 1.0 / 20.0 ) * ( 1.0 - x * ( 1.0 / 42.0 ) *
+            ( 1.0 - x * ( 1.0 / 72.0 ) * ( 1.0 - x * ( 1.0 / 110.0 ) ) ) ) ) );
+    }
+
+    // exp( j*d ) for |d| <= tinyAngle, by Taylor series through d^7. The truncation error is below 1e-19.
+    constexpr double tinyAngle = 1.0 / 64.0;
+    REISER_RT_FLYING_PHASOR_ROTATION_INLINE void tinyRotation( double d, double & c, double & s )
+    {
+        const double x = d * d;
+        c = 1.0 - x * ( 1.0 / 2.0 ) * ( 1.0 - x * ( 1.0 / 12.0 ) * ( 1.0 - x * ( 1.0 / 30.0 ) ) );
+        s = d * ( 1.0 - x * ( 1.0 / 6.0 ) * ( 1.0 - x * ( 1.0 / 20.0 ) * ( 1.0 - x * ( 1.0 / 42.0 ) ) ) );
+    }
+
+    // Rotates a run of samples by anchor * exp( j*( p - anchorAngle ) ) for a sequence of angles p, in place.
+    // The complex multiplies are written out, as for mixing.
+    void rotateRun( FlyingPhasorElementBufferTypePtr pElementBuffer, const double * pAngles, size_t numSamples,
+                    const FlyingPhasorElementType & anchor, double anchorAngle )
+    {
+        const double anchorRe = anchor.real();
+        const double anchorIm = anchor.imag();
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            double c, s;
+            smallRotation( pAngles[ i ] - anchorAngle, c, s );
+            const double offsetRe = anchorRe * c - anchorIm * s;
+            const double offsetIm = anchorRe * s + anchorIm * c;
+            const double re = pElementBuffer[ i ].real();
+            const double im = pElementBuffer[ i ].imag();
+            pElementBuffer[ i ] = FlyingPhasorElementType{ re * offsetRe - im * offsetIm, re * offsetIm + im * offsetRe };
+        }
+    }
+
+    // Rotates samples by exp( j*p ) for a sequence of angles p, in place.
+    class PhaseOffsetRotator
+    {
+    public:
+        void rotate( FlyingPhasorElementBufferTypePtr pElementBuffer, const double * pPhases, size_t numSamples )
+        {
+            size_t i = 0;
+            while ( numSamples != i )
+            {
+                if ( !( std::fabs( pPhases[ i ] - anchorAngle ) <= maxSmallAngle ) )
+                {
+                    anchor = std::polar( 1.0, pPhases[ i ] );
+                    anchorAngle = pPhases[ i ];
+                }
+
+                size_t end = i + 1;
+                while ( numSamples != end && std::fabs( pPhases[ end ] - anchorAngle ) <= maxSmallAngle )
+                    ++end;
+
+                rotateRun( pElementBuffer + i, pPhases + i, end - i, anchor, anchorAngle );
+                i = end;
+            }
+        }
+
+    private:
+        FlyingPhasorElementType anchor{ 1.0, 0.0 };
+        double anchorAngle{};
+    };
+
+    // exp( j*d ) for any d. Up to twice the small angle range, we square the rotation for half the angle.
+    // Beyond that, we resort to std::polar.
+    FlyingPhasorElementType rotation( double d )
+    {
+        double c, s;
+        if ( std::fabs( d ) <= maxSmallAngle )
+        {
+            smallRotation( d, c, s );
+            return FlyingPhasorElementType{ c, s };
+        }
+        if ( std::fabs( d ) <= 2.0 * maxSmallAngle )
+        {
+            smallRotation( d / 2.0, c, s );
+            return FlyingPhasorElementType{ c * c - s * s, 2.0 * c * s };
+        }
+        return std::polar( 1.0, d );
+    }
+
+    // Rotates samples by exp( j*d ) for a sequence of offsets d, all within range of the rotation series, in place.
+    template< void ( *smallOffsetRotation )( double, double &, double & ) >
+    REISER_RT_FLYING_PHASOR_ROTATION_INLINE void rotateByOffsets( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                                  const double * pOffsets, size_t numSamples )
+    {
+        // std::complex is array compatible. Viewed as doubles, the loop vectorizes in the functions targeting
+        // AVX2 and AVX-512F too.
+        double * pOut = reinterpret_cast< double * >( pElementBuffer );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            double c, s;
+            smallOffsetRotation( pOffsets[ i ], c, s );
+            const double re = pOut[ 2 * i ];
+            const double im = pOut[ 2 * i + 1 ];
+            pOut[ 2 * i ] = re * c - im * s;
+            pOut[ 2 * i + 1 ] = re * s + im * c;
+        }
+    }
+
+#if REISER_RT_FLYING_PHASOR_X86_ROTATION
+    template< void ( *smallOffsetRotation )( double, double &, double & ) >
+    __attribute__(( target( "avx2" ) ))
+    void rotateByOffsetsAvx2( FlyingPhasorElementBufferTypePtr pElementBuffer, const double * pOffsets,
+                              size_t numSamples )
+    {
+        rotateByOffsets< smallOffsetRotation >( pElementBuffer, pOffsets, numSamples );
+    }
+
+    template< void ( *smallOffsetRotation )( double, double &, double & ) >
+    __attribute__(( target( REISER_RT_FLYING_PHASOR_AVX512_ROTATION_TARGET ) ))
+    void rotateByOffsetsAvx512( FlyingPhasorElementBufferTypePtr pElementBuffer, const double * pOffsets,
+                                size_t numSamples )
+    {
+        rotateByOffsets< smallOffsetRotation >( pElementBuffer, pOffsets, numSamples );
+    }
+#endif
+
+    // Rotates samples by exp( j*d ) for a sequence of offsets d, in place, by the shortest series good for the
+    // largest of them. Where the SIMD kernels run, it is the same loop built for their instruction set. There is
+    // no FMA (this file is compiled without contraction), so the results are bit for bit the same.
+    void rotateByOffsets( FlyingPhasorElementBufferTypePtr pElementBuffer, const double * pOffsets, size_t numSamples,
+                          double maxOffset )
+    {
+        const bool tiny = maxOffset <= tinyAngle;
+        const bool small = maxOffset <= maxSmallAngle;
+#if REISER_RT_FLYING_PHASOR_X86_ROTATION
+        static const auto isa = Detail::flyingPhasorKernelIsa();
+        if ( Detail::FlyingPhasorKernelIsa::Avx512f == isa && small )
+        {
+            if ( tiny )
+                rotateByOffsetsAvx512< tinyRotation >( pElementBuffer, pOffsets, numSamples );
+            else
+                rotateByOffsetsAvx512< smallRotation >( pElementBuffer, pOffsets, numSamples );
+            return;
+        }
+        if ( Detail::FlyingPhasorKernelIsa::Avx2 == isa && small )
+        {
+            if ( tiny )
+                rotateByOffsetsAvx2< tinyRotation >( pElementBuffer, pOffsets, numSamples );
+            else
+                rotateByOffsetsAvx2< smallRotation >( pElementBuffer, pOffsets, numSamples );
+            return;
+        }
+#endif
+        if ( tiny )
+            rotateByOffsets< tinyRotation >( pElementBuffer, pOffsets, numSamples );
+        else if ( small )
+            rotateByOffsets< smallRotation >( pElementBuffer, pOffsets, numSamples );
+        else
+            PhaseOffsetRotator{}.rotate( pElementBuffer, pOffsets, numSamples );
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesPhaseModulated( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                          size_t numSamples, const double * pPhases )
+{
+    // The carrier goes straight into the user buffer and, is rotated in place.
+    getSamples( pElementBuffer, numSamples );
+    PhaseOffsetRotator{}.rotate( pElementBuffer, pPhases, numSamples );
+}
+
+void FlyingPhasorToneGenerator::accumSamplesPhaseModulated( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                            size_t numSamples, const double * pPhases )
+{
+    PhaseOffsetRotator rotator{};
+    FlyingPhasorElementType chunk[ Detail::flyingPhasorScratchChunkSize ];
+    while ( numSamples )
+    {
+        const size_t n = std::min( numSamples, Detail::flyingPhasorScratchChunkSize );
+        getSamples( chunk, n );
+        rotator.rotate( chunk, pPhases, n );
+        for ( size_t i = 0; n != i; ++i )
+            pElementBuffer[ i ] += chunk[ i ];
+        pElementBuffer += n;
+        pPhases += n;
+        numSamples -= n;
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesFrequencyModulated( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                              size_t numSamples, const double * pRadiansPerSample )
+{
+    frequencyModulate( pElementBuffer, numSamples, pRadiansPerSample, false );
+}
+
+void FlyingPhasorToneGenerator::accumSamplesFrequencyModulated( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                                size_t numSamples, const double * pRadiansPerSample )
+{
+    frequencyModulate( pElementBuffer, numSamples, pRadiansPerSample, true );
+}
+
+void FlyingPhasorToneGenerator::frequencyModulate( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                                   const double * pRadiansPerSample, bool accumulate )
+{
+    if ( 0 == numSamples )
+        return;
+
+    instrument( InstrumentedOperation::Get, numSamples );
+
+    const double lastRadiansPerSample = pRadiansPerSample[ numSamples - 1 ];
+
+    if ( !Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        const double carrierRate = std::atan2( rate.imag(), rate.real() );
+
+        // The rate phasor is formed from an anchor, as phase offsets are for phase modulation, and the phasor
+        // advanced by it, as getSamples would. The instantaneous frequency of smooth modulation changes little
+        // from one sample to the next, so we re-anchor once it strays beyond range of the shorter series.
+        FlyingPhasorElementType anchor = rate;
+        double anchorRate = carrierRate;
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( !( std::fabs( pRadiansPerSample[ i ] - anchorRate ) <= tinyAngle ) )
+            {
+                anchor = std::polar( 1.0, pRadiansPerSample[ i ] );
+                anchorRate = pRadiansPerSample[ i ];
+            }
+
+            double c, s;
+            tinyRotation( pRadiansPerSample[ i ] - anchorRate, c, s );
+            if ( accumulate )
+                pElementBuffer[ i ] += phasor;
+            else
+                pElementBuffer[ i ] = phasor;
+            phasor *= anchor * FlyingPhasorElementType{ c, s };
+            normalize();
+        }
+    }
+    else
+    {
+        // The carrier is generated a block at a time. Before each block, the master is rotated by the offset
+        // accrued up to the block's middle sample, so that each sample is left only its offset from that,
+        // which is small for smooth modulation.
+        // The carrier is placed midway between the lowest and highest rates, which keeps the offsets smallest.
+        // Those of smooth modulation are found well enough by looking at one rate per block, which is all that
+        // is at stake. Any carrier is exact. The carrier's angle is taken back from its phasor, as that is the
+        // angle the kernels actually advance by, to within an ULP.
+        double lowest = pRadiansPerSample[ 0 ], highest = pRadiansPerSample[ 0 ];
+        for ( size_t i = 0; numSamples > i; i += Detail::flyingPhasorLaneCount )
+        {
+            lowest = std::min( lowest, pRadiansPerSample[ i ] );
+            highest = std::max( highest, pRadiansPerSample[ i ] );
+        }
+        const auto carrier = std::polar( 1.0, lowest / 2.0 + highest / 2.0 );
+        const double carrierRate = std::atan2( carrier.imag(), carrier.real() );
+
+        Detail::FlyingPhasorLaneSeeds seeds;
+        Detail::flyingPhasorSeedLanes( carrier, seeds );
+        Detail::FlyingPhasorMaster master{ phasor };
+        FlyingPhasorElementType block[ Detail::flyingPhasorLaneCount ];
+        double offsets[ Detail::flyingPhasorLaneCount ];
+        double pending = 0.0;   // The offset accrued by the samples before the block, not yet applied.
+        while ( numSamples )
+        {
+            const size_t n = std::min( numSamples, Detail::flyingPhasorLaneCount );
+
+            // Each sample's offset from the carrier, relative to the middle sample. We accumulate outward from
+            // the middle in both directions at once, which halves the chain of dependent adds.
+            const size_t middle = n / 2;
+            double behind = 0.0, ahead = 0.0, maxBehind = 0.0, maxAhead = 0.0;
+            offsets[ middle ] = 0.0;
+            for ( size_t k = 1; n - middle != k; ++k )
+            {
+                behind -= pRadiansPerSample[ middle - k ] - carrierRate;
+                ahead += pRadiansPerSample[ middle + k - 1 ] - carrierRate;
+                offsets[ middle - k ] = behind;
+                offsets[ middle + k ] = ahead;
+                maxBehind = std::max( maxBehind, std::fabs( behind ) );
+                maxAhead = std::max( maxAhead, std::fabs( ahead ) );
+            }
+            if ( 0 != middle && 0 == n % 2 )
+            {
+                behind -= pRadiansPerSample[ 0 ] - carrierRate;
+                offsets[ 0 ] = behind;
+                maxBehind = std::max( maxBehind, std::fabs( behind ) );
+            }
+
+            // The master takes up what the block before left pending and, the offset of the middle sample.
+            const auto r = rotation( pending - behind );
+            const long double re = master.re * r.real() - master.im * r.imag();
+            master.im = master.im * r.real() + master.re * r.imag();
+            master.re = re;
+            master.refresh();
+            pending = ahead + ( pRadiansPerSample[ n - 1 ] - carrierRate );
+
+            auto pBlock = accumulate ? block : pElementBuffer;
+            if ( Detail::flyingPhasorLaneCount == n )
+            {
+                Detail::flyingPhasorKernelBlocks( Detail::FlyingPhasorKernelOp::Get, seeds, master, pBlock, 1,
+                                                  1.0, nullptr );
+                instrumentKernel( 1 );
+            }
+            else
+                phasor = Detail::flyingPhasorKernelTail( Detail::FlyingPhasorKernelOp::Get, seeds, master, pBlock, n,
+                                                         1.0, nullptr );
+
+            rotateByOffsets( pBlock, offsets, n, std::max( maxBehind, maxAhead ) );
+
+            if ( accumulate )
+                for ( size_t i = 0; n != i; ++i )
+                    pElementBuffer[ i ] += block[ i ];
+            pElementBuffer += n;
+            pRadiansPerSample += n;
+            numSamples -= n;
+            sampleCounter += n;
+
+            // After a whole last block, the next sample is the master's own.
+            if ( 0 == numSamples && Detail::flyingPhasorLaneCount == n )
+                phasor = Detail::flyingPhasorKernelTail( Detail::FlyingPhasorKernelOp::Get, seeds, master, block, 0,
+                                                         1.0, nullptr );
+        }
+
+        // The next sample carries what the last block left pending.
+        phasor *= rotation( pending );
+        phasor *= 1.0 - ( phasor.real() * phasor.real() + phasor.imag() * phasor.imag() - 1.0 ) / 2.0;
+    }
+
+    // The carrier picks up where the modulation left off, at the last rate.
+    rate = std::polar( 1.0, lastRadiansPerSample );
+}
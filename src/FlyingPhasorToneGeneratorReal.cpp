@@ -0,0 +1,147 @@
+/**
+ * @file FlyingPhasorToneGeneratorReal.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Real Only Operations
+ *
+ * The real only operations deliver exactly the real components their split plane counterparts would. Larger
+ * requests are handed off to the split plane multi-lane kernels, told to leave the imaginary plane alone, so that
+ * only the real components are derived and stored. Smaller requests run the same serial recurrence as the
+ * split plane operations, which must carry the whole phasor along regardless.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+using namespace ReiserRT::Signal;
+
+void FlyingPhasorToneGenerator::getSamplesReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples )
+{
+    instrument( InstrumentedOperation::Get, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::Get, phasor, rate,
+                                                 pRealBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real();
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples,
+                                                      double scalar )
+{
+    instrument( InstrumentedOperation::GetScaled, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::GetScaled, phasor, rate,
+                                                 pRealBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real() * scalar;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples,
+                                                      const double * pScalars )
+{
+    instrument( InstrumentedOperation::GetEnveloped, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::GetEnveloped, phasor, rate,
+                                                 pRealBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real() * *pScalars++;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples )
+{
+    instrument( InstrumentedOperation::Accum, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::Accum, phasor, rate,
+                                                 pRealBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real();
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples,
+                                                        double scalar )
+{
+    instrument( InstrumentedOperation::AccumScaled, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::AccumScaled, phasor, rate,
+                                                 pRealBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real() * scalar;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesScaledReal( FlyingPhasorPlaneBufferTypePtr pRealBuffer, size_t numSamples,
+                                                        const double * pScalars )
+{
+    instrument( InstrumentedOperation::AccumEnveloped, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorRealKernel( Detail::FlyingPhasorKernelOp::AccumEnveloped, phasor, rate,
+                                                 pRealBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real() * *pScalars++;
+        phasor *= rate;
+        normalize();
+    }
+}
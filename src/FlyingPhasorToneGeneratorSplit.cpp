@@ -0,0 +1,159 @@
+/**
+ * @file FlyingPhasorToneGeneratorSplit.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Split Plane Operations
+ *
+ * The split plane operations deliver exactly the samples their interleaved counterparts would. Larger requests
+ * are handed off to the split plane multi-lane kernels, where each SIMD register holds consecutive real or
+ * imaginary components and, no shuffling is required. Smaller requests run the same serial recurrence as the
+ * interleaved operations.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+using namespace ReiserRT::Signal;
+
+void FlyingPhasorToneGenerator::getSamplesSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                 FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples )
+{
+    instrument( InstrumentedOperation::Get, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::Get, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real();
+        *pImagBuffer++ = phasor.imag();
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                       FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples,
+                                                       double scalar )
+{
+    instrument( InstrumentedOperation::GetScaled, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::GetScaled, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real() * scalar;
+        *pImagBuffer++ = phasor.imag() * scalar;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::getSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                       FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples,
+                                                       const double * pScalars )
+{
+    instrument( InstrumentedOperation::GetEnveloped, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::GetEnveloped, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ = phasor.real() * *pScalars;
+        *pImagBuffer++ = phasor.imag() * *pScalars++;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                   FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples )
+{
+    instrument( InstrumentedOperation::Accum, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::Accum, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, 1.0, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real();
+        *pImagBuffer++ += phasor.imag();
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                         FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples,
+                                                         double scalar )
+{
+    instrument( InstrumentedOperation::AccumScaled, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::AccumScaled, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, scalar, nullptr );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real() * scalar;
+        *pImagBuffer++ += phasor.imag() * scalar;
+        phasor *= rate;
+        normalize();
+    }
+}
+
+void FlyingPhasorToneGenerator::accumSamplesScaledSplit( FlyingPhasorPlaneBufferTypePtr pRealBuffer,
+                                                         FlyingPhasorPlaneBufferTypePtr pImagBuffer, size_t numSamples,
+                                                         const double * pScalars )
+{
+    instrument( InstrumentedOperation::AccumEnveloped, numSamples );
+
+    if ( Detail::flyingPhasorUseKernel( numSamples ) )
+    {
+        phasor = Detail::flyingPhasorSplitKernel( Detail::FlyingPhasorKernelOp::AccumEnveloped, phasor, rate,
+                                                  pRealBuffer, pImagBuffer, numSamples, 1.0, pScalars );
+        sampleCounter += numSamples;
+        instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+        return;
+    }
+
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        *pRealBuffer++ += phasor.real() * *pScalars;
+        *pImagBuffer++ += phasor.imag() * *pScalars++;
+        phasor *= rate;
+        normalize();
+    }
+}
@@ -0,0 +1,39 @@
+/**
+ * @file FlyingPhasorToneGeneratorStreaming.cpp
+ * @brief The Implementation file for the Flying Phasor Tone Generator Streaming Operations
+ *
+ * Streaming requests are handed to the streaming multi-lane kernel, which delivers exactly what getSamples
+ * would, storing whole blocks straight from its registers with non-temporal stores. A line written in full
+ * that way goes to memory through the write combining buffers, without first being read in for ownership.
+ * A store fence at the end makes the streamed samples visible to other threads in order with everything else
+ * before we return. We tried generating into a small scratch chunk in cache and streaming that out instead.
+ * The extra pass, and the bursts of streaming stores that stall the core, made that slower than getSamples
+ * at every buffer size.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneGeneratorKernels.h"
+
+#include <cstdint>
+
+using namespace ReiserRT::Signal;
+
+void FlyingPhasorToneGenerator::getSamplesStreaming( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                     size_t numSamples )
+{
+    // Small requests are not worth streaming and, the kernel requires whole sample alignment.
+    if ( !Detail::flyingPhasorUseKernel( numSamples ) ||
+         0 != reinterpret_cast< std::uintptr_t >( pElementBuffer ) % sizeof( FlyingPhasorElementType ) )
+    {
+        getSamples( pElementBuffer, numSamples );
+        return;
+    }
+
+    instrument( InstrumentedOperation::Get, numSamples );
+    phasor = Detail::flyingPhasorStreamKernel( phasor, rate, pElementBuffer, numSamples );
+    sampleCounter += numSamples;
+    instrumentKernel( numSamples / Detail::flyingPhasorLaneCount );
+}
@@ -0,0 +1,93 @@
+// Created on 20261016
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include "CommandLineParser.h"
+#include "PurityAnalyzer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+
+void printHelpScreen()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    longRunPurity [options]" << std::endl;
+    std::cout << "Analyzes the phase and magnitude purity of a long run of the tone generator, on every available" << std::endl;
+    std::cout << "hardware thread, without ever holding more than a chunk of samples per thread in memory." << std::endl;
+    std::cout << "Available Options:" << std::endl;
+    std::cout << "    --help" << std::endl;
+    std::cout << "        Displays this help screen and exits." << std::endl;
+    std::cout << "    --radsPerSample=<double>" << std::endl;
+    std::cout << "        The number of radians per sample to be generated." << std::endl;
+    std::cout << "        Defaults to pi/256 radians per sample if unspecified." << std::endl;
+    std::cout << "    --phase=<double>" << std::endl;
+    std::cout << "        The initial phase of the starting sample in radians." << std::endl;
+    std::cout << "        Defaults to 0.0 radians if unspecified." << std::endl;
+    std::cout << "    --chunkSize=<uint>" << std::endl;
+    std::cout << "        Together with numChunks, the number of samples to analyze is their product." << std::endl;
+    std::cout << "        Defaults to 4096 samples if unspecified." << std::endl;
+    std::cout << "    --numChunks=<uint>" << std::endl;
+    std::cout << "        Together with chunkSize, the number of samples to analyze is their product." << std::endl;
+    std::cout << "        Defaults to 1 chunk if unspecified." << std::endl;
+    std::cout << "        For example, --chunkSize=1000000 --numChunks=10000 analyzes 10^10 samples." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Error Returns:" << std::endl;
+    std::cout << "    1 - Command Line Parsing Error - Unrecognized Long Option." << std::endl;
+    std::cout << "    2 - Command Line Parsing Error - Unrecognized Short Option (none supported)." << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    // Parse potential command line. Defaults provided otherwise.
+    CommandLineParser cmdLineParser{};
+
+    auto parseRes = cmdLineParser.parseCommandLine(argc, argv);
+    if ( 0 != parseRes )
+    {
+        std::cerr << "longRunPurity Parse Error: Use command line argument --help for instructions" << std::endl;
+        exit(parseRes);
+    }
+
+    if ( cmdLineParser.getHelpFlag() )
+    {
+        printHelpScreen();
+        exit( 0 );
+    }
+
+    const auto radiansPerSample = cmdLineParser.getRadsPerSample();
+    const auto phi = cmdLineParser.getPhase();
+    const size_t numSamples = size_t( cmdLineParser.getChunkSize() ) * cmdLineParser.getNumChunks();
+
+    FlyingPhasorToneGenerator gen{ radiansPerSample, phi };
+    PhasePurityAnalyzer phasePurityAnalyzer{};
+    MagPurityAnalyzer magPurityAnalyzer{};
+
+    const auto t0 = std::chrono::steady_clock::now();
+    analyzeTonePurity( gen, radiansPerSample, numSamples, 0, phasePurityAnalyzer, magPurityAnalyzer );
+    const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - t0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    const auto phaseStats = phasePurityAnalyzer.getStats();
+    const auto phaseMinMaxDev = phasePurityAnalyzer.getMinMaxDev();
+    const auto magStats = magPurityAnalyzer.getStats();
+    const auto magMinMaxDev = magPurityAnalyzer.getMinMaxDev();
+    const double signalPower = magStats.first * magStats.first / 2;
+    std::cout << "Samples analyzed: " << phasePurityAnalyzer.getSampleCount() << " in " << elapsed.count()
+              << " seconds." << std::endl;
+    std::cout << "Mean Angular Rate: " << phaseStats.first << ", Variance: " << phaseStats.second
+              << ", Mean Error: " << phasePurityAnalyzer.getMeanRateError() << std::endl;
+    std::cout << "Phase Noise: maxNegDev: " << phaseMinMaxDev.first << ", maxPosDev: " << phaseMinMaxDev.second
+              << ", maxAbsDev: " << std::max( -phaseMinMaxDev.first, phaseMinMaxDev.second ) << std::endl;
+    std::cout << "Mean Magnitude: " << magStats.first << ", Variance: " << magStats.second
+              << ", SNR: " << 10.0 * std::log10( signalPower / magStats.second ) << " dB" << std::endl;
+    std::cout << "Magnitude Noise: maxNegDev: " << magMinMaxDev.first << ", maxPosDev: " << magMinMaxDev.second
+              << ", maxAbsDev: " << std::max( -magMinMaxDev.first, magMinMaxDev.second ) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file normalizationReport.cpp
+ * @brief Cost and Purity Report for Normalization Policies and Periods
+ *
+ * For each combination of normalization policy and period, this generates a long tone with
+ * FlyingPhasorToneGeneratorInline and reports, side by side, what it costs and what it does to purity.
+ *
+ * Cost is nanoseconds per sample, for bulk getSamples and for a per sample getSample loop.
+ *
+ * Purity is measured against an ideal tone formed in extended precision at the angle of the rounded rate
+ * phasor. Rounding of the rate itself is common to every combination and, is deliberately left out. We
+ * report the worst magnitude error, the noise floor (total error power relative to the tone) and, the worst
+ * normalization spur. Normalizing every P samples modulates magnitude with period P, which puts spurs at
+ * multiples of fs/P. We measure those with a DFT of the magnitude error at each of those frequencies.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorInline.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 1 << 20;
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    double toDb( double power ) { return 10.0 * std::log10( power ); }
+
+    template< size_t NormalizationPeriod, typename NormalizationPolicy >
+    void report( const std::string & policyName, const FlyingPhasorElementType * pIdeal, FlyingPhasorElementType * pBuf )
+    {
+        using GeneratorType = FlyingPhasorToneGeneratorInline< NormalizationPeriod, NormalizationPolicy >;
+
+        // Bulk cost.
+        GeneratorType bulkGen{ radiansPerSample, phi };
+        auto start = std::chrono::steady_clock::now();
+        bulkGen.getSamples( pBuf, NUM_SAMPLES );
+        const double bulkNs = std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count();
+
+        // Per sample cost, into the same buffer so that the result is used.
+        GeneratorType sampleGen{ radiansPerSample, phi };
+        start = std::chrono::steady_clock::now();
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+            pBuf[ i ] = sampleGen.getSample();
+        const double sampleNs = std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count();
+
+        // Purity.
+        double maxMagError = 0.0;
+        double errorPower = 0.0;
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        {
+            maxMagError = std::max( maxMagError, std::fabs( std::abs( pBuf[ i ] ) - 1.0 ) );
+            errorPower += std::norm( pBuf[ i ] - pIdeal[ i ] );
+        }
+        errorPower /= NUM_SAMPLES;
+
+        // Magnitude modulation at multiples of fs/P lands the same distance either side of the tone,
+        // half its power to each. We report the worst of them.
+        double worstSpurPower = 0.0;
+        for ( size_t k = 1; NormalizationPeriod / 2 >= k; ++k )
+        {
+            const double w = 2.0 * M_PI * double( k ) / NormalizationPeriod;
+            std::complex< double > bin{};
+            for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+                bin += ( std::abs( pBuf[ i ] ) - 1.0 ) * std::polar( 1.0, -w * double( i % NormalizationPeriod ) );
+            const double amplitude = std::abs( bin ) / NUM_SAMPLES;
+            worstSpurPower = std::max( worstSpurPower, amplitude * amplitude / 4.0 );
+        }
+
+        std::cout << std::left << std::setw( 20 ) << policyName << std::right
+                  << std::setw( 8 ) << NormalizationPeriod
+                  << std::fixed << std::setprecision( 2 )
+                  << std::setw( 12 ) << bulkNs / NUM_SAMPLES
+                  << std::setw( 12 ) << sampleNs / NUM_SAMPLES
+                  << std::scientific << std::setprecision( 2 )
+                  << std::setw( 14 ) << maxMagError
+                  << std::fixed << std::setprecision( 1 )
+                  << std::setw( 14 ) << toDb( errorPower )
+                  << std::setw( 14 );
+        // Normalizing every sample leaves no periodic modulation and so, no spur to speak of.
+        if ( 1 == NormalizationPeriod )
+            std::cout << "-" << std::endl;
+        else
+            std::cout << toDb( worstSpurPower ) << std::endl;
+    }
+
+    template< typename NormalizationPolicy >
+    void reportPeriods( const std::string & policyName, const FlyingPhasorElementType * pIdeal, FlyingPhasorElementType * pBuf )
+    {
+        report< 1, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 2, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 4, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 8, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 16, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 64, NormalizationPolicy >( policyName, pIdeal, pBuf );
+        report< 256, NormalizationPolicy >( policyName, pIdeal, pBuf );
+    }
+}
+
+int main()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > idealBuf{new FlyingPhasorElementType[ NUM_SAMPLES ] };
+    std::unique_ptr< FlyingPhasorElementType[] > sampleBuf{new FlyingPhasorElementType[ NUM_SAMPLES ] };
+
+    const auto rate = std::polar( 1.0, radiansPerSample );
+    const long double theta = std::atan2( (long double)rate.imag(), (long double)rate.real() );
+    const auto phasor = std::polar( 1.0, phi );
+    const long double phi0 = std::atan2( (long double)phasor.imag(), (long double)phasor.real() );
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        const auto ideal = std::polar( 1.0L, phi0 + theta * (long double)i );
+        idealBuf[ i ] = FlyingPhasorElementType{ double( ideal.real() ), double( ideal.imag() ) };
+    }
+
+    std::cout << "Samples: " << NUM_SAMPLES << ", radians per sample: " << radiansPerSample << std::endl;
+    std::cout << std::left << std::setw( 20 ) << "Policy" << std::right
+              << std::setw( 8 ) << "Period"
+              << std::setw( 12 ) << "Bulk ns"
+              << std::setw( 12 ) << "Sample ns"
+              << std::setw( 14 ) << "Max |mag-1|"
+              << std::setw( 14 ) << "Noise dBc"
+              << std::setw( 14 ) << "Spur dBc" << std::endl;
+
+    reportPeriods< FirstOrderTaylorNormalization >( "FirstOrderTaylor", idealBuf.get(), sampleBuf.get() );
+    reportPeriods< SecondOrderTaylorNormalization >( "SecondOrderTaylor", idealBuf.get(), sampleBuf.get() );
+    reportPeriods< ExactNormalization >( "Exact", idealBuf.get(), sampleBuf.get() );
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file spectralAnalyzer.cpp
+ * @brief Spectral Purity Analyzer with Regression Gate
+ *
+ * This measures the spur free dynamic range (SFDR), the strongest spur and, the noise floor of a complex
+ * tone by way of the SpectrumAnalyzer in the testUtilities library. The tone is either generated directly by
+ * a FlyingPhasorToneGenerator or, read from standard input in the binary stream formats written by
+ * streamFlyingPhasorGen and streamLegacyPhasorGen. Power spectra of successive blocks may be averaged.
+ * The averaged power spectrum may be written out for plotting, in the two column binary format the
+ * gnuplot workflow in graphics/PlotNotes.txt uses (fraction of sample rate, dB, 32 bit floats).
+ *
+ * Given a minimum SFDR or a maximum noise floor, this fails if the measurement falls short of either. Under
+ * ctest, that catches spectral purity regressions from any change to the generator or its kernels.
+ *
+ * The default rate, pi/256 radians per sample, is centered on a bin for any FFT size of 512 or more and so,
+ * the rectangular window (no window) is the default. For rates not centered on a bin, use the
+ * Blackman-Harris window, which bounds what can be measured to around 92 dB.
+ *
+ * Usage: spectralAnalyzer [options]
+ *     --source=<string>       gen - Generate the tone with getSamples (multi-lane kernels). The default.
+ *                             serial - Generate the tone with getSample, one sample at a time.
+ *                             b32 - Read 32 bit binary I/Q from standard input.
+ *                             b64 - Read 64 bit binary I/Q from standard input.
+ *     --includeX              The input stream includes the sample count column (see --includeX of the
+ *                             stream utilities).
+ *     --radsPerSample=<real>  The rate of the generated tone. Defaults to pi/256.
+ *     --phase=<real>          The initial phase of the generated tone. Defaults to 0.0.
+ *     --fftSize=<uint>        A power of two of at least 16. Defaults to 65536.
+ *     --averages=<uint>       The number of blocks whose power spectra are averaged. Defaults to 1.
+ *     --window=<string>       rect or bh (4-term Blackman-Harris). Defaults to rect.
+ *     --spectrum=<path>       Write the averaged power spectrum to a file.
+ *     --minSfdr=<real>        Fail if the SFDR in dB is less than this.
+ *     --maxNoiseFloor=<real>  Fail if the noise floor in dBc is greater than this.
+ *
+ * Returns zero on success, one if a limit is not met and, two on a usage, input or file error.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include "SpectrumAnalyzer.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    enum class Source : short { Invalid=0, Generator, Serial, Bin32, Bin64 };
+
+    struct Options
+    {
+        Source source{ Source::Generator };
+        bool includeX{ false };
+        double radiansPerSample{ M_PI / 256 };
+        double phi{ 0.0 };
+        size_t fftSize{ 65536 };
+        size_t averages{ 1 };
+        SpectrumAnalyzer::Window window{ SpectrumAnalyzer::Window::Rectangular };
+        std::string spectrumPath{};
+        double minSfdr{ -std::numeric_limits< double >::infinity() };
+        double maxNoiseFloor{ std::numeric_limits< double >::infinity() };
+    };
+
+    bool parseOptions( int argc, char * argv[], Options & options )
+    {
+        for ( int i = 1; argc != i; ++i )
+        {
+            const std::string arg{ argv[ i ] };
+            const auto eq = arg.find( '=' );
+            const std::string name = arg.substr( 0, eq );
+            const std::string value = std::string::npos == eq ? std::string{} : arg.substr( eq + 1 );
+
+            if ( "--source" == name )
+            {
+                if ( "gen" == value ) options.source = Source::Generator;
+                else if ( "serial" == value ) options.source = Source::Serial;
+                else if ( "b32" == value ) options.source = Source::Bin32;
+                else if ( "b64" == value ) options.source = Source::Bin64;
+                else options.source = Source::Invalid;
+            }
+            else if ( "--window" == name )
+            {
+                if ( "rect" == value ) options.window = SpectrumAnalyzer::Window::Rectangular;
+                else if ( "bh" == value ) options.window = SpectrumAnalyzer::Window::BlackmanHarris;
+                else return false;
+            }
+            else if ( "--includeX" == name ) options.includeX = true;
+            else if ( "--radsPerSample" == name ) options.radiansPerSample = std::strtod( value.c_str(), nullptr );
+            else if ( "--phase" == name ) options.phi = std::strtod( value.c_str(), nullptr );
+            else if ( "--fftSize" == name ) options.fftSize = std::strtoul( value.c_str(), nullptr, 10 );
+            else if ( "--averages" == name ) options.averages = std::strtoul( value.c_str(), nullptr, 10 );
+            else if ( "--spectrum" == name ) options.spectrumPath = value;
+            else if ( "--minSfdr" == name ) options.minSfdr = std::strtod( value.c_str(), nullptr );
+            else if ( "--maxNoiseFloor" == name ) options.maxNoiseFloor = std::strtod( value.c_str(), nullptr );
+            else
+            {
+                std::cerr << "spectralAnalyzer: unrecognized option " << arg << std::endl;
+                return false;
+            }
+        }
+
+        return Source::Invalid != options.source && 0 != options.averages;
+    }
+
+    // Reads a block of samples in one of the stream formats, without or with the sample count column.
+    template< typename Count, typename Real >
+    bool readBlock( FlyingPhasorElementBufferTypePtr pBuf, size_t numSamples, bool includeX )
+    {
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            Count x;
+            Real iq[ 2 ];
+            if ( includeX && !std::cin.read( reinterpret_cast< char * >( &x ), sizeof( x ) ) )
+                return false;
+            if ( !std::cin.read( reinterpret_cast< char * >( iq ), sizeof( iq ) ) )
+                return false;
+            pBuf[ n ] = FlyingPhasorElementType{ iq[ 0 ], iq[ 1 ] };
+        }
+        return true;
+    }
+
+    bool writeSpectrum( const std::string & path, const SpectrumAnalyzer & analyzer )
+    {
+        std::ofstream out{ path, std::ios::binary };
+        if ( !out )
+            return false;
+
+        // From the most negative frequency to the most positive, for plotting.
+        const auto spectrum = analyzer.getPowerSpectrumDb();
+        const size_t fftSize = analyzer.getFftSize();
+        for ( size_t i = 0; fftSize != i; ++i )
+        {
+            const size_t k = ( i + fftSize / 2 ) % fftSize;
+            const float columns[ 2 ] = { float( analyzer.binToFraction( k ) ), float( spectrum[ k ] ) };
+            out.write( reinterpret_cast< const char * >( columns ), sizeof( columns ) );
+        }
+        return bool( out );
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    Options options{};
+    if ( !parseOptions( argc, argv, options ) )
+    {
+        std::cerr << "spectralAnalyzer: invalid options. See the file header for usage." << std::endl;
+        return 2;
+    }
+
+    std::unique_ptr< SpectrumAnalyzer > pAnalyzer{};
+    try
+    {
+        pAnalyzer.reset( new SpectrumAnalyzer{ options.fftSize, options.window } );
+    }
+    catch ( const std::invalid_argument & e )
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+
+    FlyingPhasorToneGenerator gen{ options.radiansPerSample, options.phi };
+    std::unique_ptr< FlyingPhasorElementType[] > buf{ new FlyingPhasorElementType[ options.fftSize ] };
+    for ( size_t a = 0; options.averages != a; ++a )
+    {
+        bool ok = true;
+        switch ( options.source )
+        {
+            case Source::Generator:
+                gen.getSamples( buf.get(), options.fftSize );
+                break;
+            case Source::Serial:
+                for ( size_t n = 0; options.fftSize != n; ++n )
+                    buf[ n ] = gen.getSample();
+                break;
+            case Source::Bin32:
+                ok = readBlock< uint32_t, float >( buf.get(), options.fftSize, options.includeX );
+                break;
+            default:
+                ok = readBlock< uint64_t, double >( buf.get(), options.fftSize, options.includeX );
+                break;
+        }
+
+        if ( !ok )
+        {
+            std::cerr << "spectralAnalyzer: input ended within block " << a << std::endl;
+            return 2;
+        }
+        pAnalyzer->addSamples( buf.get() );
+    }
+
+    if ( !options.spectrumPath.empty() && !writeSpectrum( options.spectrumPath, *pAnalyzer ) )
+    {
+        std::cerr << "spectralAnalyzer: unable to write " << options.spectrumPath << std::endl;
+        return 2;
+    }
+
+    const auto results = pAnalyzer->analyze();
+    std::cout.precision( 6 );
+    std::cout << std::fixed;
+    std::cout << "FFT size: " << options.fftSize << ", averages: " << pAnalyzer->getNumAverages() << std::endl;
+    std::cout << "Tone: " << pAnalyzer->binToFraction( results.peakBin ) << " of the sample rate, "
+              << results.peakPowerDb << " dB" << std::endl;
+    std::cout << "Worst spur: " << pAnalyzer->binToFraction( results.spurBin ) << " of the sample rate, "
+              << results.spurPowerDbc << " dBc" << std::endl;
+    std::cout << "SFDR: " << results.sfdrDb << " dB" << std::endl;
+    std::cout << "Noise floor: " << results.noiseFloorDbc << " dBc per bin (median)" << std::endl;
+
+    int retCode = 0;
+    if ( options.minSfdr > results.sfdrDb )
+    {
+        std::cout << "SFDR is less than " << options.minSfdr << " dB" << std::endl;
+        retCode = 1;
+    }
+    if ( options.maxNoiseFloor < results.noiseFloorDbc )
+    {
+        std::cout << "Noise floor is greater than " << options.maxNoiseFloor << " dBc" << std::endl;
+        retCode = 1;
+    }
+
+    return retCode;
+}
@@ -1,12 +1,15 @@
 // Created on 20220109
 
+#include "FlyingPhasorBufferPool.h"
 #include "FlyingPhasorToneGenerator.h"
 
+#include "BinaryStreamWriter.h"
 #include "CommandLineParser.h"
 
+#include <chrono>
 #include <iostream>
-#include <memory>
 #include <limits>
+#include <memory>
 
 using namespace ReiserRT::Signal;
 
@@ -43,11 +46,27 @@ void printHelpScreen()
     std::cout << "    --includeX" << std::endl;
     std::cout << "        Include sample count in the output stream. This is useful for gnuplot using any format." << std::endl;
     std::cout << "        Defaults to no inclusion if unspecified." << std::endl;
+    std::cout << "    --vmsplice" << std::endl;
+    std::cout << "        In the binary formats, where standard output is a pipe (Linux), splice full staging buffers" << std::endl;
+    std::cout << "        into it rather than copying them. Only for a reader that copies out of the pipe. One that" << std::endl;
+    std::cout << "        splices onward (tee, pv, socat and the like may) would deliver corrupted data." << std::endl;
+    std::cout << "        Defaults to copying if unspecified." << std::endl;
     std::cout << std::endl;
     std::cout << "Error Returns:" << std::endl;
     std::cout << "    1 - Command Line Parsing Error - Unrecognized Long Option." << std::endl;
     std::cout << "    2 - Command Line Parsing Error - Unrecognized Short Option (none supported)." << std::endl;
     std::cout << "    3 - Invalid streamFormat specified." << std::endl;
+    std::cout << "    4 - Output write error (binary formats)." << std::endl;
+    std::cout << std::endl;
+    std::cout << "The binary formats report the bytes written and the rate achieved to standard error." << std::endl;
+}
+
+void reportRate( uint64_t bytesWritten, std::chrono::steady_clock::duration elapsed, bool splicing )
+{
+    const double seconds = std::chrono::duration< double >( elapsed ).count();
+    std::cerr << "streamFlyingPhasorGen: " << bytesWritten << " bytes in " << seconds << " seconds, "
+              << ( 0.0 < seconds ? double( bytesWritten ) / seconds / 1e6 : 0.0 ) << " MB/s"
+              << ( splicing ? " (vmsplice)" : " (write)" ) << std::endl;
 }
 
 int main( int argc, char * argv[] )
@@ -96,8 +115,8 @@ int main( int argc, char * argv[] )
     // Instantiate a FlyingPhasor
     FlyingPhasorToneGenerator flyingPhasorToneGenerator{ radiansPerSample, phi };
 
-    // Allocate Memory for Chunk Size
-    std::unique_ptr< FlyingPhasorElementType[] > pToneSeries{new FlyingPhasorElementType [ chunkSize ] };
+    // Allocate Memory for Chunk Size, aligned and pre-faulted. A chunk size of zero still gets a buffer.
+    FlyingPhasorBufferPool pool{ 1, chunkSize ? chunkSize : 1 };
 
     // If we are using a text stream format, set the output precision
     if ( CommandLineParser::StreamFormat::Text32 == streamFormat)
@@ -113,24 +132,26 @@ int main( int argc, char * argv[] )
 
     // Are we including Sample count in the output?
     auto includeX = cmdLineParser.getIncludeX();
-
-    FlyingPhasorElementBufferTypePtr p = pToneSeries.get();
-    size_t sampleCount = 0;
-    size_t skippedChunks = 0;
-    for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+    auto vmsplice = cmdLineParser.getVmsplice();
+
+    // Binary formats go through a bulk writer on standard output.
+    std::unique_ptr< BinaryStreamWriter > pBinaryWriter{};
+    if ( CommandLineParser::StreamFormat::Bin32 == streamFormat )
+        pBinaryWriter.reset( new BinaryStreamWriter{ BinaryStreamWriter::Format::Bin32, includeX, 1, vmsplice } );
+    else if ( CommandLineParser::StreamFormat::Bin64 == streamFormat )
+        pBinaryWriter.reset( new BinaryStreamWriter{ BinaryStreamWriter::Format::Bin64, includeX, 1, vmsplice } );
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // Skip chunks. The flying phasor jumps ahead in constant time, no matter how many.
+    size_t sampleCount = skipChunks * chunkSize;
+    flyingPhasorToneGenerator.skipSamples( sampleCount );
+
+    FlyingPhasorElementBufferTypePtr p = pool.acquire();
+    for ( size_t chunk = skipChunks; numChunks != chunk; ++chunk )
     {
-        // Get Samples. If we are skipping chunks, we may not output, but we must
-        // maintain flying phasor state.
+        // Get Samples.
         flyingPhasorToneGenerator.getSamples( p, chunkSize );
 
-        // Skip this Chunk?
-        if ( skipChunks != skippedChunks )
-        {
-            ++skippedChunks;
-            sampleCount += chunkSize;
-            continue;
-        }
-
         if ( CommandLineParser::StreamFormat::Text32 == streamFormat ||
             CommandLineParser::StreamFormat::Text64 == streamFormat )
         {
@@ -139,38 +160,29 @@ int main( int argc, char * argv[] )
                 if ( includeX ) std::cout << sampleCount++ << " ";
                 std::cout << p[n].real() << " " << p[n].imag() << std::endl;
             }
+            std::cout.flush();
         }
-        else if ( CommandLineParser::StreamFormat::Bin32 == streamFormat )
+        else
         {
-            for ( size_t n = 0; chunkSize != n; ++n )
+            // Binary formats are converted a whole chunk at a time and, written out in bulk.
+            if ( !pBinaryWriter->write( p, chunkSize, sampleCount ) )
             {
-                if ( includeX )
-                {
-                    auto sVal = uint32_t( sampleCount++);
-                    std::cout.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
-                }
-                auto fVal = float( p[n].real() );
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
-                fVal = float( p[n].imag() );
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+                std::cerr << "streamFlyingPhasorGen Error: Writing output failed." << std::endl;
+                exit( 4 );
             }
+            sampleCount += chunkSize;
         }
-        else if ( CommandLineParser::StreamFormat::Bin64 == streamFormat )
+    }
+
+    if ( pBinaryWriter )
+    {
+        if ( !pBinaryWriter->flush() )
         {
-            for ( size_t n = 0; chunkSize != n; ++n )
-            {
-                if ( includeX )
-                {
-                    auto sVal = sampleCount++;
-                    std::cout.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
-                }
-                auto fVal = p[n].real();
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
-                fVal = p[n].imag();
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
-            }
+            std::cerr << "streamFlyingPhasorGen Error: Writing output failed." << std::endl;
+            exit( 4 );
         }
-        std::cout.flush();
+        reportRate( pBinaryWriter->getBytesWritten(), std::chrono::steady_clock::now() - startTime,
+                    pBinaryWriter->isSplicing() );
     }
 
     exit( 0 );
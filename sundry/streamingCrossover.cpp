@@ -0,0 +1,99 @@
+/**
+ * @file streamingCrossover.cpp
+ * @brief Crossover Benchmark for Streaming Stores
+ *
+ * For buffer sizes doubling from 64KB up to a maximum, this times getSamples against getSamplesStreaming,
+ * filling the same buffer over and over, and reports the throughput of each side by side. Small buffers stay in
+ * cache, where normal stores win. Once the buffer is well beyond the last level cache, every normal store costs
+ * a read of the line for ownership as well as the eventual write back, and streaming stores should win.
+ * The crossover is reported as the smallest buffer size from which streaming wins at every larger size measured.
+ *
+ * Usage: streamingCrossover [maxMiB], where maxMiB defaults to 1024.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorBufferPool.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr size_t minBytes = size_t( 64 ) << 10;
+
+    // We repeat until at least this much time has passed, or this many repetitions, and keep the best.
+    constexpr double minSeconds = 0.25;
+    constexpr int minRepetitions = 3;
+
+    // Best seconds per fill of numSamples.
+    template< typename Fill >
+    double bestSeconds( Fill fill )
+    {
+        double best = 1e300;
+        double total = 0.0;
+        for ( int r = 0; minRepetitions > r || minSeconds > total; ++r )
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fill();
+            const double seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+            best = std::min( best, seconds );
+            total += seconds;
+        }
+        return best;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    const size_t maxMiB = 1 < argc ? size_t( std::strtoul( argv[ 1 ], nullptr, 10 ) ) : 1024;
+    const size_t maxBytes = std::max( maxMiB << 20, minBytes );
+    const size_t maxSamples = maxBytes / sizeof( FlyingPhasorElementType );
+
+    // A single cache line aligned buffer, pre-faulted so that first touch costs are not measured.
+    FlyingPhasorBufferPool pool{ 1, maxSamples };
+    const auto pBuf = pool.acquire();
+
+    FlyingPhasorToneGenerator gen{ radiansPerSample };
+
+    std::cout << std::setw( 12 ) << "Size KiB" << std::setw( 16 ) << "Normal GB/s" << std::setw( 16 ) << "Stream GB/s"
+              << std::setw( 10 ) << "Ratio" << std::endl;
+
+    std::vector< size_t > sizes{};
+    std::vector< bool > streamWins{};
+    for ( size_t bytes = minBytes; maxBytes >= bytes; bytes *= 2 )
+    {
+        const size_t numSamples = bytes / sizeof( FlyingPhasorElementType );
+        const double normal = bestSeconds( [ & ]() { gen.getSamples( pBuf, numSamples ); } );
+        const double stream = bestSeconds( [ & ]() { gen.getSamplesStreaming( pBuf, numSamples ); } );
+
+        std::cout << std::setw( 12 ) << ( bytes >> 10 )
+                  << std::fixed << std::setprecision( 2 )
+                  << std::setw( 16 ) << double( bytes ) / normal / 1e9
+                  << std::setw( 16 ) << double( bytes ) / stream / 1e9
+                  << std::setw( 10 ) << normal / stream << std::endl;
+
+        sizes.push_back( bytes );
+        streamWins.push_back( stream < normal );
+    }
+
+    // Working back from the largest size, while streaming keeps winning.
+    size_t i = sizes.size();
+    while ( 0 != i && streamWins[ i - 1 ] )
+        --i;
+    if ( sizes.size() == i )
+        std::cout << "No crossover. Normal stores won at the largest size measured." << std::endl;
+    else
+        std::cout << "Crossover: streaming wins from " << ( sizes[ i ] >> 10 ) << " KiB up." << std::endl;
+
+    return 0;
+}
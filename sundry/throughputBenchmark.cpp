@@ -0,0 +1,371 @@
+/**
+ * @file throughputBenchmark.cpp
+ * @brief Throughput Benchmark Suite with Regression Gate
+ *
+ * For buffer sizes growing by a factor of four, from well within the L1 data cache to several times the last
+ * level cache, this times each operation of interest filling the same buffer over and over. Each operation is
+ * warmed up and then, timed over a number of runs. A run repeats the fill until a minimum time has passed, so
+ * that the clock's resolution does not matter even for the smallest buffers. The median and, the 10th and
+ * 90th percentiles of throughput across runs are reported as CSV, along with the speedup of the median over
+ * the legacy std::exp path at the same size. Each size is labelled with the cache level it fits in.
+ *
+ * Given a baseline (a CSV previously written by this benchmark), each operation and size found in both is
+ * compared and, the benchmark fails if any has regressed by more than a tolerance. A size showing a regression
+ * is measured a second time and, each operation there keeps the better of its two measurements, so that a
+ * momentary disturbance does not fail the benchmark. By default, speedups are compared rather than absolute
+ * throughput. Both sides of a speedup run on the same machine, so a baseline recorded on one machine remains
+ * meaningful on another. With --absolute, samples per second are compared instead, which is only meaningful
+ * against a baseline recorded on the same machine.
+ *
+ * Speedups depend on the kernel in use, so a baseline is only comparable when the same kernel is selected now as
+ * when it was recorded. Given the kernel a baseline was recorded with, the benchmark skips the comparison
+ * altogether, without measuring anything, should another kernel be selected.
+ *
+ * Usage: throughputBenchmark [options]
+ *     --quick             Only L1 and L2 sized buffers, with fewer runs. This is what ctest runs.
+ *     --maxMiB=<uint>     The largest buffer to sweep, in MiB. Defaults to 1024.
+ *     --runs=<uint>       Timed runs per operation and size. Defaults to 11, or 7 when quick.
+ *     --csv=<path>        Write the CSV to a file rather than standard output.
+ *     --baseline=<path>   Compare against a baseline CSV.
+ *     --tolerance=<real>  The fraction of baseline that may be lost before failing. Defaults to 0.5.
+ *     --absolute          Compare samples per second rather than speedups.
+ *     --baselineKernel=<name>  The kernel the baseline was recorded with ("generic", "avx2" or "avx512f").
+ *
+ * Returns zero on success, one on a regression, two on a usage or file error and, 77 (skipped, in ctest's
+ * terms) when the baseline's kernel is not the one selected.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorBufferPool.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined( __unix__ )
+#include <unistd.h>
+#endif
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+    constexpr double scalar = 3.0;
+
+    constexpr size_t minSamples = 256;
+    constexpr int warmUpRuns = 2;
+    constexpr double minRunSeconds = 0.002;
+    constexpr int skippedReturnCode = 77;
+
+    const char * const legacyName = "legacyExp";
+
+    struct Options
+    {
+        bool quick{ false };
+        size_t maxMiB{ 1024 };
+        int runs{ 0 };
+        std::string csvPath{};
+        std::string baselinePath{};
+        double tolerance{ 0.5 };
+        bool absolute{ false };
+        std::string baselineKernel{};
+    };
+
+    struct Result
+    {
+        std::string operation;
+        size_t samples;
+        std::string regime;
+        double median;
+        double p10;
+        double p90;
+        double speedup;
+    };
+
+    // The cache sizes in bytes, where the platform reports them, and typical sizes otherwise.
+    struct CacheSizes
+    {
+        size_t l1{ size_t( 32 ) << 10 };
+        size_t l2{ size_t( 1 ) << 20 };
+        size_t l3{ size_t( 32 ) << 20 };
+    };
+
+    CacheSizes getCacheSizes()
+    {
+        CacheSizes sizes{};
+#if defined( _SC_LEVEL1_DCACHE_SIZE ) && defined( _SC_LEVEL2_CACHE_SIZE ) && defined( _SC_LEVEL3_CACHE_SIZE )
+        const long l1 = sysconf( _SC_LEVEL1_DCACHE_SIZE );
+        const long l2 = sysconf( _SC_LEVEL2_CACHE_SIZE );
+        const long l3 = sysconf( _SC_LEVEL3_CACHE_SIZE );
+        if ( 0 < l1 ) sizes.l1 = size_t( l1 );
+        if ( 0 < l2 ) sizes.l2 = size_t( l2 );
+        if ( 0 < l3 ) sizes.l3 = size_t( l3 );
+#endif
+        return sizes;
+    }
+
+    const char * regimeOf( size_t bytes, const CacheSizes & caches )
+    {
+        if ( caches.l1 >= bytes ) return "L1";
+        if ( caches.l2 >= bytes ) return "L2";
+        if ( caches.l3 >= bytes ) return "L3";
+        return "DRAM";
+    }
+
+    bool parseOptions( int argc, char * argv[], Options & options )
+    {
+        for ( int i = 1; argc != i; ++i )
+        {
+            const std::string arg{ argv[ i ] };
+            const auto eq = arg.find( '=' );
+            const std::string name = arg.substr( 0, eq );
+            const std::string value = std::string::npos == eq ? std::string{} : arg.substr( eq + 1 );
+
+            if ( "--quick" == name ) options.quick = true;
+            else if ( "--absolute" == name ) options.absolute = true;
+            else if ( "--maxMiB" == name ) options.maxMiB = std::strtoul( value.c_str(), nullptr, 10 );
+            else if ( "--runs" == name ) options.runs = std::atoi( value.c_str() );
+            else if ( "--csv" == name ) options.csvPath = value;
+            else if ( "--baseline" == name ) options.baselinePath = value;
+            else if ( "--baselineKernel" == name ) options.baselineKernel = value;
+            else if ( "--tolerance" == name ) options.tolerance = std::strtod( value.c_str(), nullptr );
+            else
+            {
+                std::cerr << "throughputBenchmark: unrecognized option " << arg << std::endl;
+                return false;
+            }
+        }
+
+        if ( 0 == options.runs )
+            options.runs = options.quick ? 7 : 11;
+        return 0 < options.runs && 0.0 <= options.tolerance && 1.0 > options.tolerance;
+    }
+
+    // Seconds per fill, for each timed run.
+    template< typename Fill >
+    std::vector< double > timeRuns( int runs, Fill fill )
+    {
+        for ( int r = 0; warmUpRuns != r; ++r )
+            fill();
+
+        std::vector< double > secondsPerFill{};
+        for ( int r = 0; runs != r; ++r )
+        {
+            size_t fills = 0;
+            double seconds = 0.0;
+            const auto start = std::chrono::steady_clock::now();
+            do
+            {
+                fill();
+                ++fills;
+                seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+            } while ( minRunSeconds > seconds );
+            secondsPerFill.push_back( seconds / double( fills ) );
+        }
+        return secondsPerFill;
+    }
+
+    // Nearest rank percentile of samples per second. Throughput is inversely ordered to time.
+    double percentile( std::vector< double > secondsPerFill, size_t samples, double fraction )
+    {
+        std::sort( secondsPerFill.begin(), secondsPerFill.end() );
+        const size_t rank = size_t( ( 1.0 - fraction ) * double( secondsPerFill.size() - 1 ) + 0.5 );
+        return double( samples ) / secondsPerFill[ rank ];
+    }
+
+    // Every operation at one size.
+    std::vector< Result > measureSize( size_t samples, int runs, FlyingPhasorElementBufferTypePtr p,
+                                       FlyingPhasorToneGenerator & gen, const CacheSizes & caches )
+    {
+        constexpr FlyingPhasorElementType j{ 0.0, 1.0 };
+        struct Operation
+        {
+            const char * name;
+            std::vector< double > secondsPerFill;
+        };
+        std::vector< Operation > operations{
+            { legacyName, timeRuns( runs, [ & ]() {
+                for ( size_t n = 0; samples != n; ++n )
+                    p[ n ] = std::exp( j * ( double( n ) * radiansPerSample + phi ) ); } ) },
+            { "getSample", timeRuns( runs, [ & ]() {
+                for ( size_t n = 0; samples != n; ++n )
+                    p[ n ] = gen.getSample(); } ) },
+            { "getSamples", timeRuns( runs, [ & ]() { gen.getSamples( p, samples ); } ) },
+            { "getSamplesScaled", timeRuns( runs, [ & ]() { gen.getSamplesScaled( p, samples, scalar ); } ) },
+            { "accumSamples", timeRuns( runs, [ & ]() { gen.accumSamples( p, samples ); } ) },
+            { "accumSamplesScaled", timeRuns( runs, [ & ]() { gen.accumSamplesScaled( p, samples, scalar ); } ) },
+        };
+
+        std::vector< Result > results{};
+        const double legacyMedian = percentile( operations.front().secondsPerFill, samples, 0.5 );
+        for ( const auto & op : operations )
+        {
+            const double median = percentile( op.secondsPerFill, samples, 0.5 );
+            results.push_back( Result{ op.name, samples, regimeOf( samples * sizeof( FlyingPhasorElementType ), caches ),
+                                       median, percentile( op.secondsPerFill, samples, 0.1 ),
+                                       percentile( op.secondsPerFill, samples, 0.9 ), median / legacyMedian } );
+        }
+        return results;
+    }
+
+    void writeCsv( std::ostream & os, const std::vector< Result > & results )
+    {
+        os << "operation,samples,bytes,regime,median_samples_per_sec,p10_samples_per_sec,p90_samples_per_sec,speedup"
+           << std::endl;
+        for ( const auto & r : results )
+            os << r.operation << ',' << r.samples << ',' << r.samples * sizeof( FlyingPhasorElementType ) << ','
+               << r.regime << ',' << r.median << ',' << r.p10 << ',' << r.p90 << ',' << r.speedup << std::endl;
+    }
+
+    bool readCsv( const std::string & path, std::vector< Result > & results )
+    {
+        std::ifstream is{ path };
+        if ( !is )
+            return false;
+
+        std::string line{};
+        std::getline( is, line );   // The header.
+        while ( std::getline( is, line ) )
+        {
+            std::istringstream fields{ line };
+            std::vector< std::string > f{};
+            std::string field{};
+            while ( std::getline( fields, field, ',' ) )
+                f.push_back( field );
+            if ( 8 != f.size() )
+                continue;
+
+            results.push_back( Result{ f[ 0 ], std::strtoull( f[ 1 ].c_str(), nullptr, 10 ), f[ 3 ],
+                                       std::strtod( f[ 4 ].c_str(), nullptr ), std::strtod( f[ 5 ].c_str(), nullptr ),
+                                       std::strtod( f[ 6 ].c_str(), nullptr ), std::strtod( f[ 7 ].c_str(), nullptr ) } );
+        }
+        return true;
+    }
+
+    // Returns the number of regressions, at the given size only or, at every size if zero.
+    int compareToBaseline( const std::vector< Result > & results, const std::vector< Result > & baseline,
+                           const Options & options, size_t samples, bool report )
+    {
+        int regressions = 0;
+        for ( const auto & b : baseline )
+        {
+            if ( ( !options.absolute && legacyName == b.operation ) || ( 0 != samples && samples != b.samples ) )
+                continue;
+
+            auto it = std::find_if( results.begin(), results.end(), [ & ]( const Result & r )
+                { return r.operation == b.operation && r.samples == b.samples; } );
+            if ( results.end() == it )
+                continue;
+
+            const double measured = options.absolute ? it->median : it->speedup;
+            const double expected = options.absolute ? b.median : b.speedup;
+            const bool regressed = measured < expected * ( 1.0 - options.tolerance );
+            if ( report )
+                std::cerr << ( regressed ? "REGRESSED " : "ok        " ) << b.operation << " at " << b.samples
+                          << " samples: " << measured << ( options.absolute ? " samples/sec" : "x" )
+                          << " against a baseline of " << expected << std::endl;
+            if ( regressed )
+                ++regressions;
+        }
+        return regressions;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    Options options{};
+    if ( !parseOptions( argc, argv, options ) )
+    {
+        std::cerr << "throughputBenchmark: invalid options. See the file header for usage." << std::endl;
+        return 2;
+    }
+
+    const char * kernelName = FlyingPhasorToneGenerator::getKernelName();
+    if ( !options.baselinePath.empty() && !options.baselineKernel.empty() && options.baselineKernel != kernelName )
+    {
+        std::cout << "throughputBenchmark: skipped, the baseline was recorded with the " << options.baselineKernel
+                  << " kernel but, the " << kernelName << " kernel is selected" << std::endl;
+        return skippedReturnCode;
+    }
+
+    // Sizes grow by four from minSamples until several times the last level cache, or the maximum.
+    const auto caches = getCacheSizes();
+    const size_t maxBytes = options.quick ? caches.l2 / 2 : std::max( options.maxMiB << 20,
+                                                                       minSamples * sizeof( FlyingPhasorElementType ) );
+    std::vector< size_t > sizes{};
+    for ( size_t samples = minSamples; maxBytes >= samples * sizeof( FlyingPhasorElementType ); samples *= 4 )
+    {
+        sizes.push_back( samples );
+        if ( 4 * caches.l3 <= samples * sizeof( FlyingPhasorElementType ) )
+            break;
+    }
+
+    FlyingPhasorBufferPool pool{ 1, sizes.back() };
+    const auto p = pool.acquire();
+    FlyingPhasorToneGenerator gen{ radiansPerSample, phi };
+
+    std::vector< Result > results{};
+    for ( auto samples : sizes )
+    {
+        const auto measured = measureSize( samples, options.runs, p, gen, caches );
+        results.insert( results.end(), measured.begin(), measured.end() );
+    }
+
+    // Timing on a busy machine is noisy. Sizes with an apparent regression are measured again and,
+    // each operation keeps the better of its two measurements.
+    std::vector< Result > baseline{};
+    if ( !options.baselinePath.empty() )
+    {
+        if ( !readCsv( options.baselinePath, baseline ) )
+        {
+            std::cerr << "throughputBenchmark: unable to read " << options.baselinePath << std::endl;
+            return 2;
+        }
+
+        for ( auto samples : sizes )
+        {
+            if ( 0 == compareToBaseline( results, baseline, options, samples, false ) )
+                continue;
+
+            for ( const auto & again : measureSize( samples, options.runs, p, gen, caches ) )
+            {
+                auto & first = *std::find_if( results.begin(), results.end(), [ & ]( const Result & r )
+                    { return r.operation == again.operation && r.samples == again.samples; } );
+                if ( ( options.absolute ? first.median : first.speedup ) < ( options.absolute ? again.median : again.speedup ) )
+                    first = again;
+            }
+        }
+    }
+
+    if ( options.csvPath.empty() )
+        writeCsv( std::cout, results );
+    else
+    {
+        std::ofstream os{ options.csvPath };
+        if ( !os )
+        {
+            std::cerr << "throughputBenchmark: unable to write " << options.csvPath << std::endl;
+            return 2;
+        }
+        writeCsv( os, results );
+    }
+
+    if ( options.baselinePath.empty() )
+        return 0;
+
+    const int regressions = compareToBaseline( results, baseline, options, 0, true );
+    if ( 0 != regressions )
+        std::cerr << regressions << " regression(s) beyond a tolerance of " << options.tolerance << std::endl;
+    return 0 == regressions ? 0 : 1;
+}
@@ -2,8 +2,9 @@
 // Created by Frank Reiser on 8/3/22.
 //
 
-#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorToneBank.h"
 
+#include <cmath>
 #include <memory>
 #include <iostream>
 
@@ -23,31 +24,27 @@ int main()
     constexpr double radPerSecToneA = 2.0 * M_PI * freqToneA / sampleRate;
     constexpr double radPerSecToneB = 2.0 * M_PI * freqToneB / sampleRate;
 
-    // Flying Phasor Tone Generators are cheap to use. They do zero dynamic allocation,
-    // and contain only a minimal amount of state data. We are going to instantiate two directly on the stack.
-    ReiserRT::Signal::FlyingPhasorToneGenerator toneGenA{ radPerSecToneA };
-    ReiserRT::Signal::FlyingPhasorToneGenerator toneGenB{ radPerSecToneB };
+    // A Flying Phasor Tone Bank sums its tones in double precision and so, rounds the sum once on its way to
+    // fixed point. Two tone generators, each converting to fixed point, would round each tone.
+    ReiserRT::Signal::FlyingPhasorToneBank toneBank{};
+    toneBank.addTone( radPerSecToneA );
+    toneBank.addTone( radPerSecToneB );
 
-    // Buffers for an epoch's worth of data for each tone.
-    using SampleType = ReiserRT::Signal::FlyingPhasorElementType;
-    std::unique_ptr< SampleType > toneBuf{new SampleType[ NUM_SAMPLES  ] };
+    // A buffer for an epoch's worth of interleaved 16bit signed integer I/Q data, as an acquisition
+    // device would deliver it.
+    using IQType = ReiserRT::Signal::FlyingPhasorSC16Type;
+    std::unique_ptr< IQType[] > iqBuf{new IQType[ 2 * NUM_SAMPLES ] };
 
-    // Get data from each of the tone generators.
-    toneGenA.getSamples(toneBuf.get(), NUM_SAMPLES );
-    toneGenB.accumSamples( toneBuf.get(), NUM_SAMPLES );
-
-    // The result is two sinusoidal signals of amplitude 1, added together. Scaling and conversion to
-    // 16bit signed integer to be done by consumer of output from the two tone result.
-    // The result max deviation from zero is +/-2.0. To scale this to be withing +/-32767 integer values.
-    // Suggesting half range of +/-16383 to be comfortably within acquired digital signal range, so we multiply by 8192.
-    auto pSample = toneBuf.get();
-    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
-        *pSample++ *= 8192;
+    // The result is two sinusoidal signals of amplitude 1, added together. Its max deviation from zero is
+    // +/-2.0. Suggesting half range of +/-16383 to be comfortably within acquired digital signal range, we scale
+    // by 8192 of the 32767 full scale, converting to 16bit signed integer directly.
+    constexpr double fullScaleGain = 8192.0 / 32767.0;
+    toneBank.getSamplesSC16( iqBuf.get(), NUM_SAMPLES, fullScaleGain );
 
     // Print out a few samples, so we can evaluate what has transpired.
-    pSample = toneBuf.get();
-    for ( size_t i = 0; 20 != i; ++i, ++pSample )
-        std::cout << pSample->real() << ", " << pSample->imag() << std::endl;
+    auto pSample = iqBuf.get();
+    for ( size_t i = 0; 20 != i; ++i, pSample += 2 )
+        std::cout << pSample[ 0 ] << ", " << pSample[ 1 ] << std::endl;
 
     return 0;
 }
@@ -0,0 +1,250 @@
+// Created on 20261016
+
+#include "BinaryStreamWriter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define TSG_FLYINGPHASORTONEGEN_HAVE_POSIX_IO 1
+#if defined( __linux__ ) && defined( F_SETPIPE_SZ )
+#define TSG_FLYINGPHASORTONEGEN_HAVE_VMSPLICE 1
+#endif
+#endif
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Each of the two staging buffers. A pipe may be sized up to this by an unprivileged process by default
+    // (/proc/sys/fs/pipe-max-size).
+    constexpr size_t stagingBufferBytes = size_t( 1 ) << 20;
+
+    // The largest record, a uint64 sample count and two doubles.
+    constexpr size_t maxRecordSize = 24;
+
+    size_t pageSize()
+    {
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_POSIX_IO
+        return size_t( sysconf( _SC_PAGESIZE ) );
+#else
+        return 4096;
+#endif
+    }
+
+    template< typename T >
+    inline char * put( char * pOut, T value )
+    {
+        std::memcpy( pOut, &value, sizeof( value ) );
+        return pOut + sizeof( value );
+    }
+
+    // Without the sample count, the components are simply converted in order. std::complex is array
+    // compatible, so the samples are viewed as an array of twice as many doubles and, the loop vectorizes.
+    template< typename Count, typename Real >
+    char * convertRecords( const FlyingPhasorElementType * pSamples, size_t numSamples, uint64_t sampleCount,
+                           bool includeX, char * pOut )
+    {
+        const double * pIn = reinterpret_cast< const double * >( pSamples );
+        if ( !includeX )
+        {
+            for ( size_t i = 0; 2 * numSamples != i; ++i )
+                pOut = put( pOut, Real( pIn[ i ] ) );
+            return pOut;
+        }
+
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            pOut = put( pOut, Count( sampleCount + n ) );
+            pOut = put( pOut, Real( pIn[ 2 * n ] ) );
+            pOut = put( pOut, Real( pIn[ 2 * n + 1 ] ) );
+        }
+        return pOut;
+    }
+}
+
+BinaryStreamWriter::BinaryStreamWriter( Format theFormat, bool theIncludeX, int theFd, bool allowSplicing )
+    : format{ theFormat }
+    , includeX{ theIncludeX }
+    , fd{ theFd }
+    , recordSize{ Format::Bin32 == theFormat ? ( theIncludeX ? size_t( 12 ) : size_t( 8 ) )
+                                             : ( theIncludeX ? size_t( 24 ) : size_t( 16 ) ) }
+{
+    // Page aligned staging buffers, as vmsplice wants whole pages. They are mapped, pre-faulted where the platform
+    // allows, so that they are never returned to the heap while the pipe may still hold their pages.
+    const size_t page = pageSize();
+    stagingBytes = std::max( stagingBufferBytes, page );
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_POSIX_IO
+#ifdef MAP_POPULATE
+    const int populate = MAP_POPULATE;
+#else
+    const int populate = 0;
+#endif
+    void * const pMapped = mmap( nullptr, 2 * stagingBytes, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | populate, -1, 0 );
+    if ( MAP_FAILED != pMapped )
+    {
+        pMapping = pMapped;
+        mappingBytes = 2 * stagingBytes;
+        pStaging[ 0 ] = static_cast< char * >( pMapped );
+    }
+#endif
+
+    // Otherwise, from the heap. These are never spliced.
+    if ( !pMapping )
+    {
+        arena.resize( 2 * stagingBytes + page );
+        const auto address = reinterpret_cast< uintptr_t >( arena.data() );
+        pStaging[ 0 ] = arena.data() + ( page - address % page ) % page;
+    }
+    pStaging[ 1 ] = pStaging[ 0 ] + stagingBytes;
+
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_VMSPLICE
+    // Splicing is only safe if the pipe holds exactly one staging buffer. Linux rounds the size requested up
+    // to a power of two pages, so anything else falls back to writes.
+    struct stat status{};
+    splicing = allowSplicing && nullptr != pMapping && 0 == fstat( fd, &status ) && S_ISFIFO( status.st_mode ) &&
+               int( stagingBytes ) == fcntl( fd, F_SETPIPE_SZ, int( stagingBytes ) );
+#else
+    (void)allowSplicing;
+#endif
+}
+
+BinaryStreamWriter::~BinaryStreamWriter()
+{
+    flush();
+
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_POSIX_IO
+    if ( pMapping )
+        munmap( pMapping, mappingBytes );
+#endif
+}
+
+bool BinaryStreamWriter::write( const FlyingPhasorElementType * pSamples, size_t numSamples,
+                                uint64_t firstSampleCount )
+{
+    while ( !failed )
+    {
+        // As many whole records as fit.
+        const size_t numWhole = std::min( numSamples, ( stagingBytes - fill ) / recordSize );
+        convert( pSamples, numWhole, firstSampleCount, pStaging[ current ] + fill );
+        fill += numWhole * recordSize;
+        pSamples += numWhole;
+        firstSampleCount += numWhole;
+        numSamples -= numWhole;
+        if ( 0 == numSamples )
+            break;
+
+        // The next record straddles the end of the staging buffer. It is converted aside, its head completes
+        // this buffer, which is written out and, its tail begins the other.
+        char record[ maxRecordSize ];
+        convert( pSamples, 1, firstSampleCount, record );
+        const size_t head = stagingBytes - fill;
+        std::memcpy( pStaging[ current ] + fill, record, head );
+        if ( !writeOut( pStaging[ current ], stagingBytes, true ) )
+            break;
+
+        current ^= 1;
+        fill = recordSize - head;
+        std::memcpy( pStaging[ current ], record + head, fill );
+        ++pSamples;
+        ++firstSampleCount;
+        --numSamples;
+    }
+
+    return !failed;
+}
+
+bool BinaryStreamWriter::flush()
+{
+    // A partial buffer is always copied out rather than spliced, so the buffer may be refilled at once.
+    if ( 0 != fill && writeOut( pStaging[ current ], fill, false ) )
+        fill = 0;
+
+    return !failed;
+}
+
+char * BinaryStreamWriter::convert( const FlyingPhasorElementType * pSamples, size_t numSamples,
+                                    uint64_t firstSampleCount, char * pOut ) const
+{
+    if ( Format::Bin32 == format )
+        return convertRecords< uint32_t, float >( pSamples, numSamples, firstSampleCount, includeX, pOut );
+
+    return convertRecords< uint64_t, double >( pSamples, numSamples, firstSampleCount, includeX, pOut );
+}
+
+bool BinaryStreamWriter::writeOut( const char * pBytes, size_t numBytes, bool wholeBuffer )
+{
+    if ( failed )
+        return false;
+
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_VMSPLICE
+    if ( splicing && wholeBuffer )
+    {
+        size_t spliced = 0;
+        while ( numBytes != spliced )
+        {
+            iovec iov{ const_cast< char * >( pBytes + spliced ), numBytes - spliced };
+            const ssize_t result = vmsplice( fd, &iov, 1, 0 );
+            if ( 0 < result )
+                spliced += size_t( result );
+            else if ( 0 > result && EINTR == errno )
+                continue;
+            else if ( 0 == spliced )
+            {
+                // Not supported after all. Copy this buffer and all that follow.
+                splicing = false;
+                break;
+            }
+            else
+            {
+                failed = true;
+                return false;
+            }
+        }
+
+        if ( splicing )
+        {
+            bytesWritten += numBytes;
+            return true;
+        }
+    }
+#else
+    (void)wholeBuffer;
+#endif
+
+#ifdef TSG_FLYINGPHASORTONEGEN_HAVE_POSIX_IO
+    size_t written = 0;
+    while ( numBytes != written )
+    {
+        const ssize_t result = ::write( fd, pBytes + written, numBytes - written );
+        if ( 0 < result )
+            written += size_t( result );
+        else if ( 0 > result && EINTR == errno )
+            continue;
+        else
+        {
+            failed = true;
+            return false;
+        }
+    }
+#else
+    // Without POSIX I/O, only standard output is supported.
+    if ( numBytes != std::fwrite( pBytes, 1, numBytes, stdout ) || 0 != std::fflush( stdout ) )
+    {
+        failed = true;
+        return false;
+    }
+#endif
+
+    bytesWritten += numBytes;
+    return true;
+}
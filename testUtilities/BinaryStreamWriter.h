@@ -0,0 +1,76 @@
+// Created on 20261016
+
+#ifndef TSG_FLYINGPHASORTONEGEN_BINARYSTREAMWRITER_H
+#define TSG_FLYINGPHASORTONEGEN_BINARYSTREAMWRITER_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Writes samples to a file descriptor (standard output by default) in the binary stream formats of the stream
+// utilities: optionally a sample count (uint32 or uint64), then the real and imaginary components (float or
+// double), native endian-ness. Whole chunks are converted into a staging buffer in one pass and, the staging
+// buffer written out by large write calls as it fills, rather than a stream write per scalar.
+//
+// Only when asked to (allowSplicing), where the descriptor is a pipe and the platform supports it (Linux), the
+// pipe is sized to the staging buffer and, full staging buffers are handed to the pipe with vmsplice, which maps
+// their pages into the pipe rather than copying them. Two staging buffers alternate. Once one has been entirely
+// spliced, the pipe holds nothing else and so, the other has been consumed by the reader and, may be refilled.
+// Should any of that be unavailable, plain writes are used, as they are by default.
+//
+// Splicing relies on a reader that copies out of the pipe (read, or a utility doing so). A reader that splices
+// onward (splice or tee into another pipe, as pv, socat and the like may) empties the pipe while still referring
+// to the pages, which are then overwritten as the buffer is refilled and, the data it delivers is corrupted.
+// Nothing in the pipe says which kind of reader it has, hence the opt in. Pages may also remain in the pipe once
+// the writer has been destroyed and so, the staging buffers are mapped rather than allocated. Unmapping them
+// leaves such pages to the pipe, whereas memory returned to the heap may be reused at once.
+class BinaryStreamWriter
+{
+public:
+    enum class Format : short { Bin32=0, Bin64 };
+
+    // Splicing is attempted only if allowSplicing is true. See above for what that requires of the reader.
+    BinaryStreamWriter( Format format, bool includeX, int fd=1, bool allowSplicing=false );
+
+    // Flushes anything remaining. Errors are not reported from here, invoke flush first to learn of them.
+    ~BinaryStreamWriter();
+
+    BinaryStreamWriter( const BinaryStreamWriter & ) = delete;
+    BinaryStreamWriter & operator=( const BinaryStreamWriter & ) = delete;
+
+    // Converts and writes numSamples, the first of which is numbered firstSampleCount, should the sample count
+    // be included. Returns false once a write has failed.
+    bool write( const ReiserRT::Signal::FlyingPhasorElementType * pSamples, size_t numSamples,
+                uint64_t firstSampleCount );
+
+    // Writes out whatever remains staged. Returns false once a write has failed.
+    bool flush();
+
+    size_t getRecordSize() const { return recordSize; }
+    uint64_t getBytesWritten() const { return bytesWritten; }
+    bool isSplicing() const { return splicing; }
+
+private:
+    char * convert( const ReiserRT::Signal::FlyingPhasorElementType * pSamples, size_t numSamples,
+                    uint64_t firstSampleCount, char * pOut ) const;
+    bool writeOut( const char * pBytes, size_t numBytes, bool wholeBuffer );
+
+    const Format format;
+    const bool includeX;
+    const int fd;
+    const size_t recordSize;
+    void * pMapping{};
+    size_t mappingBytes{};
+    std::vector< char > arena;
+    char * pStaging[ 2 ]{};
+    size_t stagingBytes{};
+    size_t current{};
+    size_t fill{};
+    uint64_t bytesWritten{};
+    bool splicing{ false };
+    bool failed{ false };
+};
+
+#endif //TSG_FLYINGPHASORTONEGEN_BINARYSTREAMWRITER_H
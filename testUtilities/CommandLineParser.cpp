@@ -11,7 +11,7 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
 //    int digitOptIndex = 0;
     int retCode = 0;
 
-    enum eOptions { RadsPerSample=1, Phase, ChunkSize, NumChunks, SkipChunks, StreamFormat, Help, IncludeX };
+    enum eOptions { RadsPerSample=1, Phase, ChunkSize, NumChunks, SkipChunks, StreamFormat, Help, IncludeX, Vmsplice };
 
     // While options still left to parse
     while (true) {
@@ -26,6 +26,7 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 {"streamFormat", required_argument, nullptr, StreamFormat },
                 {"help", no_argument, nullptr, Help },
                 {"includeX", no_argument, nullptr, IncludeX },
+                {"vmsplice", no_argument, nullptr, Vmsplice },
                 {nullptr, 0, nullptr, 0 }
         };
 
@@ -83,6 +84,10 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 includeX_In = true;
                 break;
 
+            case Vmsplice:
+                vmspliceIn = true;
+                break;
+
             case '?':
 //                std::cout << "The getopt_long call returned '?'" << std::endl;
                 retCode = 1;
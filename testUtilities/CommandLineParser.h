@@ -25,6 +25,7 @@ public:
 
     inline bool getHelpFlag() const { return helpFlagIn; }
     inline bool getIncludeX() const { return includeX_In; }
+    inline bool getVmsplice() const { return vmspliceIn; }
 
 private:
     double radsPerSampleIn{ M_PI / 256 };
@@ -34,6 +35,7 @@ private:
     unsigned long skipChunksIn{ 0 };
     bool helpFlagIn{ false };
     bool includeX_In{ false };
+    bool vmspliceIn{ false };
 
     StreamFormat streamFormatIn{ StreamFormat::Text64 };
 };
@@ -0,0 +1,200 @@
+// Created on 20261016
+
+#include "PurityAnalyzer.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Stretches shorter than this are not worth a thread.
+    constexpr size_t minStretchSize = 65536;
+
+    // Samples are generated and analyzed a chunk at a time. This is small enough to stay in the L2 cache
+    // and large enough for the generator's multi-lane kernels.
+    constexpr size_t chunkSize = 8192;
+}
+
+PhasePurityAnalyzer::PhasePurityAnalyzer( double theRadiansPerSample )
+{
+    reset( theRadiansPerSample );
+}
+
+void PhasePurityAnalyzer::reset( double theRadiansPerSample )
+{
+    radiansPerSample = theRadiansPerSample;
+    conjRate = std::polar( 1.0L, -(long double)theRadiansPerSample );
+    havePrevious = false;
+    statsStateMachine.reset();
+}
+
+void PhasePurityAnalyzer::prime( const FlyingPhasorElementType & previousSample )
+{
+    previous = previousSample;
+    havePrevious = true;
+}
+
+void PhasePurityAnalyzer::addSamples( const FlyingPhasorElementType * pBuf, size_t nSamples )
+{
+    if ( 0 == nSamples )
+        return;
+
+    // We cheat the very first sample because there is no previous one in order to compute a delta.
+    // Being that we are expecting a periodic complex waveform, this would be radiansPerSample exactly.
+    size_t n = 0;
+    if ( !havePrevious )
+    {
+        statsStateMachine.addSample( 0.0 );
+        previous = pBuf[ n++ ];
+        havePrevious = true;
+    }
+
+    for ( ; nSamples != n; ++n )
+    {
+        const long double aRe = previous.real();
+        const long double aIm = previous.imag();
+        const long double bRe = pBuf[ n ].real();
+        const long double bIm = pBuf[ n ].imag();
+        previous = pBuf[ n ];
+
+        // conj( a ) * b, whose angle is the phase delta, de-rotated by the expected rate.
+        const long double dot = aRe * bRe + aIm * bIm;
+        const long double cross = aRe * bIm - aIm * bRe;
+        const long double re = dot * conjRate.real() - cross * conjRate.imag();
+        const long double im = dot * conjRate.imag() + cross * conjRate.real();
+
+        // Only the departure from radiansPerSample is accumulated. Adding it to radiansPerSample first would
+        // round it to the ULP of radiansPerSample. The mean is offset afterward.
+        statsStateMachine.addSample( double( im / re ) );
+    }
+}
+
+void PhasePurityAnalyzer::merge( const PhasePurityAnalyzer & following )
+{
+    statsStateMachine.merge( following.statsStateMachine );
+    if ( following.havePrevious )
+    {
+        previous = following.previous;
+        havePrevious = true;
+    }
+}
+
+void PhasePurityAnalyzer::analyzePhaseStability( const FlyingPhasorElementType * pBuf, size_t nSamples,
+                                                 double theRadiansPerSample )
+{
+    reset( theRadiansPerSample );
+    addSamples( pBuf, nSamples );
+}
+
+std::pair<double, double> PhasePurityAnalyzer::getStats() const
+{
+    auto stats = statsStateMachine.getStats();
+    stats.first += radiansPerSample;
+    return stats;
+}
+
+void MagPurityAnalyzer::addSamples( const FlyingPhasorElementType * pBuf, size_t nSamples )
+{
+    for ( size_t n = 0; nSamples != n; ++n )
+    {
+        const long double re = pBuf[ n ].real();
+        const long double im = pBuf[ n ].imag();
+
+        // As for phase, only the departure from one is accumulated.
+        statsStateMachine.addSample( double( ( re * re + im * im - 1.0L ) / 2.0L ) );
+    }
+}
+
+void MagPurityAnalyzer::analyzeSinusoidMagnitudeStability( const FlyingPhasorElementType * pBuf, size_t nSamples )
+{
+    reset();
+    addSamples( pBuf, nSamples );
+}
+
+std::pair<double, double> MagPurityAnalyzer::getStats() const
+{
+    auto stats = statsStateMachine.getStats();
+    stats.first += 1.0;
+    return stats;
+}
+
+void analyzeTonePurity( const FlyingPhasorToneGenerator & gen, double radiansPerSample,
+                        size_t numSamples, unsigned int numThreads,
+                        PhasePurityAnalyzer & phasePurityAnalyzer, MagPurityAnalyzer & magPurityAnalyzer )
+{
+    phasePurityAnalyzer.reset( radiansPerSample );
+    magPurityAnalyzer.reset();
+
+    if ( 0 == numThreads )
+        numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+    const size_t numStretches = std::max( size_t( 1 ),
+                                          std::min( size_t( numThreads ), numSamples / minStretchSize ) );
+
+    // The last stretch takes up any remainder. Everything a stretch needs is set up here, so that nothing
+    // can throw on the threads.
+    const size_t stretchSize = numSamples / numStretches;
+    std::vector< FlyingPhasorToneGenerator > gens( numStretches, gen );
+    std::vector< PhasePurityAnalyzer > phaseAnalyzers( numStretches, PhasePurityAnalyzer{ radiansPerSample } );
+    std::vector< MagPurityAnalyzer > magAnalyzers( numStretches );
+    std::vector< std::unique_ptr< FlyingPhasorElementType[] > > buffers{};
+    for ( size_t s = 0; numStretches != s; ++s )
+        buffers.emplace_back( new FlyingPhasorElementType[ chunkSize ] );
+
+    auto analyzeStretch = [ & ]( size_t s )
+    {
+        const size_t offset = s * stretchSize;
+        size_t remaining = numStretches - 1 == s ? numSamples - offset : stretchSize;
+        auto & g = gens[ s ];
+        auto pBuf = buffers[ s ].get();
+
+        // Every stretch but the first is primed with the sample preceding it.
+        if ( 0 != offset )
+        {
+            g.skipSamples( offset - 1 );
+            phaseAnalyzers[ s ].prime( g.getSample() );
+        }
+
+        while ( remaining )
+        {
+            const size_t n = std::min( remaining, chunkSize );
+            g.getSamples( pBuf, n );
+            phaseAnalyzers[ s ].addSamples( pBuf, n );
+            magAnalyzers[ s ].addSamples( pBuf, n );
+            remaining -= n;
+        }
+    };
+
+    std::vector< std::thread > threads{};
+    threads.reserve( numStretches - 1 );
+    for ( size_t s = 1; numStretches != s; ++s )
+    {
+        try
+        {
+            threads.emplace_back( analyzeStretch, s );
+        }
+        catch ( const std::system_error & )
+        {
+            // Could not get a thread. Do the work here instead.
+            analyzeStretch( s );
+        }
+    }
+
+    // The first stretch is ours.
+    analyzeStretch( 0 );
+
+    for ( auto & thread : threads )
+        thread.join();
+
+    for ( size_t s = 0; numStretches != s; ++s )
+    {
+        phasePurityAnalyzer.merge( phaseAnalyzers[ s ] );
+        magPurityAnalyzer.merge( magAnalyzers[ s ] );
+    }
+}
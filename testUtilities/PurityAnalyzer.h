@@ -0,0 +1,100 @@
+// Created on 20261016
+
+#ifndef TSG_FLYINGPHASORTONEGEN_PURITYANALYZER_H
+#define TSG_FLYINGPHASORTONEGEN_PURITYANALYZER_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+#include "StatsStateMachine.h"
+
+#include <complex>
+#include <cstddef>
+#include <utility>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        class FlyingPhasorToneGenerator;
+    }
+}
+
+// Analyzes the phase stability of a complex sinusoid expected to advance by radiansPerSample each sample.
+// Samples may be streamed in, any number at a time. The phase delta between successive samples is taken across
+// invocations. Rather than differencing two std::arg results per sample, the delta's departure from
+// radiansPerSample is formed from the cross and dot products of successive samples, de-rotated by the expected
+// rate, in extended precision. For departures as small as these, their ratio is the angle itself (the next term
+// is a third of its cube) and, no trig function is needed.
+//
+// Instances analyzing consecutive stretches of one waveform, perhaps on separate threads, may be merged
+// afterward, in order. The instance analyzing a stretch other than the first should be primed with the sample
+// preceding it, else that stretch's first delta is taken to be exactly radiansPerSample, as it is for the very
+// first sample analyzed.
+class PhasePurityAnalyzer
+{
+public:
+    explicit PhasePurityAnalyzer( double radiansPerSample=0.0 );
+
+    void reset( double radiansPerSample );
+    void prime( const ReiserRT::Signal::FlyingPhasorElementType & previousSample );
+    void addSamples( const ReiserRT::Signal::FlyingPhasorElementType * pBuf, size_t nSamples );
+
+    // Folds in the analysis of the stretch immediately following the one analyzed by this instance.
+    void merge( const PhasePurityAnalyzer & following );
+
+    // Resets and analyzes the nSamples given, in one go.
+    void analyzePhaseStability( const ReiserRT::Signal::FlyingPhasorElementType * pBuf, size_t nSamples,
+                                double radiansPerSample );
+
+    // Returns the mean angular rate and its variance.
+    std::pair<double, double> getStats() const;
+    std::pair<double, double> getMinMaxDev() const { return statsStateMachine.getMinMaxDev(); }
+    size_t getSampleCount() const { return statsStateMachine.getSampleCount(); }
+
+    // Returns the mean departure of the angular rate from radiansPerSample, without it being rounded to
+    // the precision of radiansPerSample, as the mean angular rate is. This is the rate error, or drift.
+    double getMeanRateError() const { return statsStateMachine.getStats().first; }
+
+private:
+    double radiansPerSample{};
+    std::complex< long double > conjRate{ 1.0, 0.0 };
+    ReiserRT::Signal::FlyingPhasorElementType previous{};
+    bool havePrevious{ false };
+    StatsStateMachine statsStateMachine{};
+};
+
+// Analyzes the magnitude stability of a complex sinusoid expected to have a magnitude of one. The departure
+// from one is taken as half that of the sum of squares, in extended precision, without a square root (the
+// next term is an eighth of the square of the latter). Samples may be streamed in and, instances merged,
+// as for PhasePurityAnalyzer.
+class MagPurityAnalyzer
+{
+public:
+    void reset() { statsStateMachine.reset(); }
+    void addSamples( const ReiserRT::Signal::FlyingPhasorElementType * pBuf, size_t nSamples );
+    void merge( const MagPurityAnalyzer & following ) { statsStateMachine.merge( following.statsStateMachine ); }
+
+    // Resets and analyzes the nSamples given, in one go.
+    void analyzeSinusoidMagnitudeStability( const ReiserRT::Signal::FlyingPhasorElementType * pBuf,
+                                            size_t nSamples );
+
+    // Returns the mean magnitude and its variance.
+    std::pair<double, double> getStats() const;
+    std::pair<double, double> getMinMaxDev() const { return statsStateMachine.getMinMaxDev(); }
+    size_t getSampleCount() const { return statsStateMachine.getSampleCount(); }
+
+private:
+    StatsStateMachine statsStateMachine{};
+};
+
+// Generates numSamples from a copy of the generator given and analyzes their phase and magnitude purity,
+// without ever holding more than a chunk of samples per thread in memory. The run is split into one stretch
+// per thread. Each thread jumps its own copy of the generator ahead to the start of its stretch (see
+// FlyingPhasorToneGenerator::skipSamples) and the partial analyses are merged, in order, once all are done.
+// The results are those of a single thread analyzing the whole run, but for rounding and, but for the
+// accumulated phase error each jump discards. A numThreads of zero uses the hardware concurrency.
+// Both analyzers are reset first, the phase analyzer to radiansPerSample.
+void analyzeTonePurity( const ReiserRT::Signal::FlyingPhasorToneGenerator & gen, double radiansPerSample,
+                        size_t numSamples, unsigned int numThreads,
+                        PhasePurityAnalyzer & phasePurityAnalyzer, MagPurityAnalyzer & magPurityAnalyzer );
+
+#endif //TSG_FLYINGPHASORTONEGEN_PURITYANALYZER_H
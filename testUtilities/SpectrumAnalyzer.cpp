@@ -0,0 +1,163 @@
+// Created on 20261016
+
+#include "SpectrumAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr long double twoPi = 6.283185307179586476925286766559005768L;
+
+    // 4-term Blackman-Harris coefficients (-92 dB side lobes).
+    constexpr double bh0 = 0.35875;
+    constexpr double bh1 = 0.48829;
+    constexpr double bh2 = 0.14128;
+    constexpr double bh3 = 0.01168;
+
+    double toDb( double ratio )
+    {
+        return 10.0 * std::log10( ratio );
+    }
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer( size_t theFftSize, Window theWindow )
+    : fftSize{ theFftSize }
+    , window{ theWindow }
+    , mainLobeHalfWidth{ Window::Rectangular == theWindow ? size_t( 1 ) : size_t( 4 ) }
+{
+    if ( 16 > fftSize || 0 != ( fftSize & ( fftSize - 1 ) ) )
+        throw std::invalid_argument{ "SpectrumAnalyzer: fftSize must be a power of two of at least 16" };
+
+    twiddles.resize( fftSize / 2 );
+    for ( size_t k = 0; fftSize / 2 != k; ++k )
+    {
+        const auto w = std::polar( 1.0L, -twoPi * (long double)k / (long double)fftSize );
+        twiddles[ k ] = std::complex< double >{ double( w.real() ), double( w.imag() ) };
+    }
+
+    // Periodic windows. A unit tone's bin then has a magnitude of the sum of the coefficients.
+    windowCoefficients.resize( fftSize );
+    double windowSum = 0.0;
+    for ( size_t n = 0; fftSize != n; ++n )
+    {
+        const double x = double( twoPi * (long double)n / (long double)fftSize );
+        windowCoefficients[ n ] = Window::Rectangular == window ? 1.0 :
+                bh0 - bh1 * std::cos( x ) + bh2 * std::cos( 2.0 * x ) - bh3 * std::cos( 3.0 * x );
+        windowSum += windowCoefficients[ n ];
+    }
+    powerScale = 1.0 / ( windowSum * windowSum );
+
+    work.resize( fftSize );
+    power.resize( fftSize );
+}
+
+void SpectrumAnalyzer::reset()
+{
+    std::fill( power.begin(), power.end(), 0.0 );
+    numAverages = 0;
+}
+
+void SpectrumAnalyzer::addSamples( const FlyingPhasorElementType * pSamples )
+{
+    for ( size_t n = 0; fftSize != n; ++n )
+        work[ n ] = pSamples[ n ] * windowCoefficients[ n ];
+
+    transform();
+
+    for ( size_t k = 0; fftSize != k; ++k )
+        power[ k ] += std::norm( work[ k ] );
+    ++numAverages;
+}
+
+SpectrumAnalyzer::Results SpectrumAnalyzer::analyze() const
+{
+    Results results{};
+    const auto spectrum = getPowerSpectrumDb();
+
+    results.peakBin = size_t( std::max_element( power.begin(), power.end() ) - power.begin() );
+    results.peakPowerDb = spectrum[ results.peakBin ];
+
+    // Everything outside of the main lobe, which may wrap around either end.
+    std::vector< double > outside{};
+    outside.reserve( fftSize );
+    results.spurBin = results.peakBin;
+    double spurPower = -1.0;
+    for ( size_t k = 0; fftSize != k; ++k )
+    {
+        const size_t distance = std::min( ( k - results.peakBin ) % fftSize, ( results.peakBin - k ) % fftSize );
+        if ( mainLobeHalfWidth >= distance )
+            continue;
+        outside.push_back( power[ k ] );
+        if ( spurPower < power[ k ] )
+        {
+            spurPower = power[ k ];
+            results.spurBin = k;
+        }
+    }
+
+    const double peakPower = power[ results.peakBin ];
+    results.spurPowerDbc = toDb( spurPower / peakPower );
+    results.sfdrDb = -results.spurPowerDbc;
+
+    auto median = outside.begin() + outside.size() / 2;
+    std::nth_element( outside.begin(), median, outside.end() );
+    results.noiseFloorDbc = toDb( *median / peakPower );
+
+    return results;
+}
+
+std::vector< double > SpectrumAnalyzer::getPowerSpectrumDb() const
+{
+    // An all but impossible zero is floored rather than taken to minus infinity.
+    const double scale = powerScale / double( std::max( numAverages, size_t( 1 ) ) );
+    std::vector< double > spectrum( fftSize );
+    for ( size_t k = 0; fftSize != k; ++k )
+        spectrum[ k ] = toDb( std::max( power[ k ] * scale, 1e-60 ) );
+    return spectrum;
+}
+
+double SpectrumAnalyzer::binToFraction( size_t bin ) const
+{
+    return fftSize / 2 > bin ? double( bin ) / double( fftSize ) : double( bin ) / double( fftSize ) - 1.0;
+}
+
+void SpectrumAnalyzer::transform()
+{
+    // Bit reversed reordering.
+    for ( size_t i = 1, j = 0; fftSize != i; ++i )
+    {
+        size_t bit = fftSize >> 1;
+        for ( ; j & bit; bit >>= 1 )
+            j ^= bit;
+        j ^= bit;
+        if ( i < j )
+            std::swap( work[ i ], work[ j ] );
+    }
+
+    // Decimation in time butterflies. The complex multiply is written out, sparing std::complex's
+    // handling of infinities and NaNs.
+    auto pWork = work.data();
+    for ( size_t len = 2; fftSize >= len; len <<= 1 )
+    {
+        const size_t half = len / 2;
+        const size_t stride = fftSize / len;
+        for ( size_t i = 0; fftSize != i; i += len )
+        {
+            for ( size_t k = 0; half != k; ++k )
+            {
+                const auto & w = twiddles[ k * stride ];
+                auto & a = pWork[ i + k ];
+                auto & b = pWork[ i + k + half ];
+                const std::complex< double > t{ b.real() * w.real() - b.imag() * w.imag(),
+                                                b.real() * w.imag() + b.imag() * w.real() };
+                b = a - t;
+                a += t;
+            }
+        }
+    }
+}
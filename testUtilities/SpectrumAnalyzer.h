@@ -0,0 +1,73 @@
+// Created on 20261016
+
+#ifndef TSG_FLYINGPHASORTONEGEN_SPECTRUMANALYZER_H
+#define TSG_FLYINGPHASORTONEGEN_SPECTRUMANALYZER_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+// Measures the spectral purity of a complex tone. Each block of fftSize samples added is windowed and
+// transformed by a radix-2 FFT and, its power spectrum accumulated, so that any number of blocks may be
+// averaged. Twiddle factors are formed individually in extended precision rather than by recurrence, which
+// keeps the transform's own errors below those of rounding a tone to double precision in the first place
+// (spurs around -320 dBc).
+//
+// Power is relative to a unit tone (0 dB), whatever the window. The strongest bin is taken to be the tone.
+// The tone's main lobe is the peak bin and, its neighbours to either side, one of them for the rectangular
+// window and four for the Blackman-Harris. Every other bin is a candidate spur. The spur free dynamic range is
+// the ratio of the tone to the strongest of those and, the noise floor is their median, relative to the tone.
+//
+// The rectangular window (no window) leaks least of all but, only for a tone centered on a bin (a whole number of cycles per block),
+// as generated tones can be. The 4-term Blackman-Harris window's side lobes are at -92 dB, which bounds what
+// can be measured of tones not centered on a bin.
+class SpectrumAnalyzer
+{
+public:
+    enum class Window : short { Rectangular=0, BlackmanHarris };
+
+    struct Results
+    {
+        size_t peakBin;         // The bin of the tone.
+        double peakPowerDb;     // The power of the tone relative to a unit tone.
+        size_t spurBin;         // The bin of the strongest spur.
+        double spurPowerDbc;    // The power of the strongest spur relative to the tone.
+        double sfdrDb;          // The spur free dynamic range.
+        double noiseFloorDbc;   // The median power per bin outside of the tone's main lobe, relative to the tone.
+    };
+
+    // Throws std::invalid_argument unless fftSize is a power of two of at least 16.
+    explicit SpectrumAnalyzer( size_t fftSize, Window window=Window::Rectangular );
+
+    void reset();
+    void addSamples( const ReiserRT::Signal::FlyingPhasorElementType * pSamples );
+
+    size_t getFftSize() const { return fftSize; }
+    size_t getNumAverages() const { return numAverages; }
+
+    Results analyze() const;
+
+    // The averaged power spectrum, in dB relative to a unit tone, in bin order (bin k is k / fftSize of the
+    // sample rate, bins at and above fftSize / 2 being negative frequencies).
+    std::vector< double > getPowerSpectrumDb() const;
+
+    // Returns the frequency of a bin as a fraction of the sample rate, in the interval [-0.5, 0.5).
+    double binToFraction( size_t bin ) const;
+
+private:
+    void transform();
+
+    const size_t fftSize;
+    const Window window;
+    const size_t mainLobeHalfWidth;
+    std::vector< std::complex< double > > twiddles;
+    std::vector< double > windowCoefficients;
+    double powerScale{};
+    std::vector< std::complex< double > > work;
+    std::vector< double > power;
+    size_t numAverages{};
+};
+
+#endif //TSG_FLYINGPHASORTONEGEN_SPECTRUMANALYZER_H
@@ -0,0 +1,92 @@
+// Created on 20261016
+
+#ifndef TSG_FLYINGPHASORTONEGEN_STATSSTATEMACHINE_H
+#define TSG_FLYINGPHASORTONEGEN_STATSSTATEMACHINE_H
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+// Performs "Running/Online" statistics accumulation.
+// Implements the Welford's "Online" in a state machine plus additional statistics.
+// This algorithm is much less prone to loss of precision due to catastrophic cancellation.
+// Additionally, it uses "long double" format for mathematics and state to better compute
+// variance from small deviations in the input train.
+class StatsStateMachine
+{
+public:
+    void addSample( double value )
+    {
+        long double delta = value - mean;
+        ++nSamples;
+        mean += delta / (long double)( nSamples );
+        M2 += delta * ( value - mean );
+
+        delta = value - mean;
+        if (delta < maxNegDev ) maxNegDev = delta;
+        if (delta > maxPosDev ) maxPosDev = delta;
+    }
+
+    // Folds in the statistics of another instance, as if its samples had been added to this one
+    // (Chan et al.'s parallel form of Welford). Instances may thus accumulate independently, on separate
+    // threads, and be combined afterward. Deviations are each relative to the running mean of the instance
+    // that saw them, so the combined min/max deviations are those of the two, whichever is greater.
+    void merge( const StatsStateMachine & other )
+    {
+        if ( 0 == other.nSamples )
+            return;
+        if ( 0 == nSamples )
+        {
+            *this = other;
+            return;
+        }
+
+        const long double n = (long double)( nSamples + other.nSamples );
+        const long double delta = other.mean - mean;
+        mean += delta * (long double)( other.nSamples ) / n;
+        M2 += other.M2 + delta * delta * (long double)( nSamples ) * (long double)( other.nSamples ) / n;
+        nSamples += other.nSamples;
+
+        if ( other.maxNegDev < maxNegDev ) maxNegDev = other.maxNegDev;
+        if ( other.maxPosDev > maxPosDev ) maxPosDev = other.maxPosDev;
+    }
+
+    size_t getSampleCount() const { return nSamples; }
+
+    // Currently, returns mean and variance
+    std::pair<double, double> getStats() const
+    {
+        switch ( nSamples )
+        {
+            case 0 : return { std::numeric_limits<long double>::quiet_NaN(), std::numeric_limits<long double>::quiet_NaN() };
+            case 1 : return { mean, std::numeric_limits<long double>::quiet_NaN() };
+            default : return { mean, M2 / (long double)(nSamples-1) };
+        }
+    }
+    std::pair<double, double> getMinMaxDev() const
+    {
+        switch ( nSamples )
+        {
+            case 0 : return { std::numeric_limits<long double>::quiet_NaN(), std::numeric_limits<long double>::quiet_NaN() };
+            default : return {maxNegDev, maxPosDev };
+        }
+    }
+
+    void reset()
+    {
+        mean = 0.0;
+        M2 = 0.0;
+        maxNegDev = std::numeric_limits< long double >::max();
+        maxPosDev = std::numeric_limits< long double >::lowest();
+        nSamples = 0;
+    }
+
+private:
+    long double mean{ 0.0 };
+    long double M2{ 0.0 };
+    long double maxNegDev{std::numeric_limits< long double >::max() };
+    long double maxPosDev{std::numeric_limits< long double >::lowest() };
+    size_t nSamples{};
+};
+
+#endif //TSG_FLYINGPHASORTONEGEN_STATSSTATEMACHINE_H
@@ -0,0 +1,201 @@
+/**
+ * @file testBinaryStreamWriter.cpp
+ * @brief Test Binary Stream Writer Functionality
+ *
+ * Whatever the format and, however samples are handed over, the bytes written must be exactly those of
+ * writing each scalar in turn, as the stream utilities once did. Enough is written to wrap both staging
+ * buffers several times, with chunk sizes that leave records straddling their ends. This is done to a file,
+ * which is written to and, to a pipe, which is written to by default. Asked to, the writer may splice into the
+ * pipe and, the pipe may still hold spliced pages once the writer is gone.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "BinaryStreamWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 300000;
+
+    // Odd chunk sizes, so that records of 12 and 24 bytes straddle the ends of the staging buffers.
+    constexpr size_t chunkSizes[] = { 1, 4095, 77777, 3, 65536 };
+
+    struct Case
+    {
+        BinaryStreamWriter::Format format;
+        bool includeX;
+    };
+
+    constexpr Case cases[] = {
+        { BinaryStreamWriter::Format::Bin32, false }, { BinaryStreamWriter::Format::Bin32, true },
+        { BinaryStreamWriter::Format::Bin64, false }, { BinaryStreamWriter::Format::Bin64, true } };
+
+    template< typename T >
+    void append( std::vector< char > & bytes, T value )
+    {
+        const char * p = reinterpret_cast< const char * >( &value );
+        bytes.insert( bytes.end(), p, p + sizeof( value ) );
+    }
+
+    // A scalar at a time, as the stream utilities once wrote them.
+    std::vector< char > expectedBytes( const std::vector< FlyingPhasorElementType > & samples, const Case & c,
+                                       uint64_t firstSampleCount )
+    {
+        std::vector< char > bytes{};
+        for ( size_t n = 0; samples.size() != n; ++n )
+        {
+            if ( BinaryStreamWriter::Format::Bin32 == c.format )
+            {
+                if ( c.includeX ) append( bytes, uint32_t( firstSampleCount + n ) );
+                append( bytes, float( samples[ n ].real() ) );
+                append( bytes, float( samples[ n ].imag() ) );
+            }
+            else
+            {
+                if ( c.includeX ) append( bytes, uint64_t( firstSampleCount + n ) );
+                append( bytes, samples[ n ].real() );
+                append( bytes, samples[ n ].imag() );
+            }
+        }
+        return bytes;
+    }
+
+    bool writeAll( BinaryStreamWriter & writer, const std::vector< FlyingPhasorElementType > & samples,
+                   uint64_t firstSampleCount )
+    {
+        for ( size_t n = 0, i = 0; samples.size() != n; ++i )
+        {
+            const size_t count = std::min( chunkSizes[ i % ( sizeof( chunkSizes ) / sizeof( chunkSizes[ 0 ] ) ) ],
+                                           samples.size() - n );
+            if ( !writer.write( samples.data() + n, count, firstSampleCount + n ) )
+                return false;
+            n += count;
+        }
+        return writer.flush();
+    }
+}
+
+int runFileTest( const std::vector< FlyingPhasorElementType > & samples )
+{
+    for ( const auto & c : cases )
+    {
+        std::FILE * pFile = std::tmpfile();
+        if ( !pFile )
+            return 1;
+
+        const uint64_t firstSampleCount = 4000000000;
+        BinaryStreamWriter writer{ c.format, c.includeX, fileno( pFile ) };
+        const bool ok = writeAll( writer, samples, firstSampleCount );
+        const auto expected = expectedBytes( samples, c, firstSampleCount );
+
+        std::vector< char > actual( expected.size() + 1 );
+        std::rewind( pFile );
+        const size_t numRead = std::fread( actual.data(), 1, actual.size(), pFile );
+        std::fclose( pFile );
+
+        if ( !ok || writer.isSplicing() || expected.size() != writer.getBytesWritten() )
+            return 2;
+        if ( expected.size() != numRead || 0 != std::memcmp( expected.data(), actual.data(), numRead ) )
+        {
+            std::cout << "File contents differ, record size " << writer.getRecordSize() << std::endl;
+            return 3;
+        }
+    }
+
+    return 0;
+}
+
+int runPipeTest( const std::vector< FlyingPhasorElementType > & samples, bool allowSplicing )
+{
+    for ( const auto & c : cases )
+    {
+        int fds[ 2 ];
+        if ( 0 != pipe( fds ) )
+            return 11;
+
+        // Read in small pieces, so that the writer fills the pipe and waits on the reader.
+        std::vector< char > actual{};
+        std::thread reader{ [ &actual, fds ]()
+        {
+            char buf[ 4096 ];
+            ssize_t result;
+            while ( 0 < ( result = read( fds[ 0 ], buf, sizeof( buf ) ) ) )
+                actual.insert( actual.end(), buf, buf + result );
+        } };
+
+        bool ok;
+        bool splicing;
+        uint64_t bytesWritten;
+        {
+            BinaryStreamWriter writer{ c.format, c.includeX, fds[ 1 ], allowSplicing };
+            ok = writeAll( writer, samples, 0 );
+            splicing = writer.isSplicing();
+            bytesWritten = writer.getBytesWritten();
+        }
+
+        // What was last spliced may not have been read yet. Memory the size of the staging buffers is put
+        // to use at once, which would overwrite it, had the writer given the buffers back to the heap.
+        std::vector< char > scribble( size_t( 4 ) << 20, char( 0x5a ) );
+        close( fds[ 1 ] );
+        reader.join();
+        close( fds[ 0 ] );
+
+        const auto expected = expectedBytes( samples, c, 0 );
+        std::cout << "Pipe, " << ( splicing ? "spliced" : "written" ) << ", " << bytesWritten << " bytes" << std::endl;
+        if ( !ok || expected.size() != bytesWritten )
+            return 12;
+        if ( expected != actual )
+            return 13;
+
+        // Splicing is never done unless asked for.
+        if ( splicing && !allowSplicing )
+            return 14;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    // Arbitrary components of all magnitudes, so that no two records look alike.
+    std::vector< FlyingPhasorElementType > samples( NUM_SAMPLES );
+    for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+        samples[ n ] = FlyingPhasorElementType{ double( n ) * 1.000000119, -1.0 / double( n + 1 ) };
+
+    do
+    {
+        retCode = runFileTest( samples );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPipeTest( samples, false );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPipeTest( samples, true );
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file testBufferPool.cpp
+ * @brief Test Buffer Pool Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorBufferPool.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    // An odd number of samples, so that the stride must be padded out to the alignment.
+    constexpr size_t NUM_BUFFERS = 8;
+    constexpr size_t SAMPLES_PER_BUFFER = 1001;
+
+    bool isAligned( const void * p, size_t alignment )
+    {
+        return 0 == reinterpret_cast< uintptr_t >( p ) % alignment;
+    }
+}
+
+int runAcquireReleaseTest( const FlyingPhasorBufferPool::Options & options )
+{
+    FlyingPhasorBufferPool pool{ NUM_BUFFERS, SAMPLES_PER_BUFFER, options };
+    if ( NUM_BUFFERS != pool.getBufferCount() || SAMPLES_PER_BUFFER != pool.getSamplesPerBuffer() ||
+         NUM_BUFFERS != pool.getAvailableCount() )
+    {
+        std::cout << "Pool reports " << pool.getBufferCount() << " buffers of " << pool.getSamplesPerBuffer()
+                  << " samples, " << pool.getAvailableCount() << " available" << std::endl;
+        return 1;
+    }
+
+    // Every buffer is aligned and, none overlaps another. Filling each one entirely, in turn, and then checking
+    // them all afterwards would reveal any overlap.
+    FlyingPhasorToneGenerator gen{ radiansPerSample, phi };
+    std::vector< FlyingPhasorElementBufferTypePtr > buffers{};
+    for ( size_t i = 0; NUM_BUFFERS != i; ++i )
+    {
+        auto p = pool.acquire();
+        if ( nullptr == p || !isAligned( p, options.alignment ) )
+        {
+            std::cout << "Buffer " << i << " is " << p << ", expected alignment " << options.alignment << std::endl;
+            return 2;
+        }
+        gen.getSamples( p, SAMPLES_PER_BUFFER );
+        buffers.push_back( p );
+    }
+
+    gen.reset( radiansPerSample, phi );
+    std::unique_ptr< FlyingPhasorElementType[] > goldenBuf{new FlyingPhasorElementType[SAMPLES_PER_BUFFER] };
+    for ( size_t i = 0; NUM_BUFFERS != i; ++i )
+    {
+        gen.getSamples( goldenBuf.get(), SAMPLES_PER_BUFFER );
+        for ( size_t n = 0; SAMPLES_PER_BUFFER != n; ++n )
+        {
+            if ( goldenBuf[ n ] != buffers[ i ][ n ] )
+            {
+                std::cout << "Buffer " << i << " was overwritten at sample " << n << std::endl;
+                return 3;
+            }
+        }
+    }
+
+    // Exhausted.
+    if ( nullptr != pool.acquire() || 0 != pool.getAvailableCount() )
+    {
+        std::cout << "An exhausted pool handed out a buffer" << std::endl;
+        return 4;
+    }
+
+    // The most recently released is handed out first.
+    pool.release( buffers[ 2 ] );
+    pool.release( buffers[ 5 ] );
+    if ( 2 != pool.getAvailableCount() || buffers[ 5 ] != pool.acquire() || buffers[ 2 ] != pool.acquire() )
+    {
+        std::cout << "Released buffers were not handed out again, most recent first" << std::endl;
+        return 5;
+    }
+
+    // Releasing null does nothing.
+    pool.release( nullptr );
+    if ( 0 != pool.getAvailableCount() )
+    {
+        std::cout << "Releasing null changed the available count" << std::endl;
+        return 6;
+    }
+
+    return 0;
+}
+
+int runInvalidReleaseTest()
+{
+    FlyingPhasorBufferPool pool{ NUM_BUFFERS, SAMPLES_PER_BUFFER };
+    auto p = pool.acquire();
+
+    try
+    {
+        pool.release( p + 1 );
+        std::cout << "Releasing a pointer into the middle of a buffer was accepted" << std::endl;
+        return 11;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    std::unique_ptr< FlyingPhasorElementType[] > foreignBuf{new FlyingPhasorElementType[SAMPLES_PER_BUFFER] };
+    try
+    {
+        pool.release( foreignBuf.get() );
+        std::cout << "Releasing a foreign buffer was accepted" << std::endl;
+        return 12;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    pool.release( p );
+    try
+    {
+        pool.release( p );
+        std::cout << "Releasing a buffer twice was accepted" << std::endl;
+        return 13;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    return NUM_BUFFERS == pool.getAvailableCount() ? 0 : 14;
+}
+
+int runInvalidArgumentTest()
+{
+    try
+    {
+        FlyingPhasorBufferPool pool{ 0, SAMPLES_PER_BUFFER };
+        std::cout << "Zero buffers was accepted" << std::endl;
+        return 21;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    try
+    {
+        FlyingPhasorBufferPool pool{ NUM_BUFFERS, 0 };
+        std::cout << "Zero samples per buffer was accepted" << std::endl;
+        return 22;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    for ( size_t alignment : { size_t( 0 ), size_t( 8 ), size_t( 96 ) } )
+    {
+        FlyingPhasorBufferPool::Options options{};
+        options.alignment = alignment;
+        try
+        {
+            FlyingPhasorBufferPool pool{ NUM_BUFFERS, SAMPLES_PER_BUFFER, options };
+            std::cout << "Alignment of " << alignment << " was accepted" << std::endl;
+            return 23;
+        }
+        catch ( const std::invalid_argument & ) {}
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        // The defaults, cache line aligned and pre-faulted.
+        FlyingPhasorBufferPool::Options options{};
+        retCode = runAcquireReleaseTest( options );
+        if ( 0 != retCode )
+            break;
+
+        // Page aligned, neither pre-faulted nor locked.
+        options.alignment = 4096;
+        options.preFault = false;
+        retCode = runAcquireReleaseTest( options );
+        if ( 0 != retCode )
+            break;
+
+        // Huge page aligned, with huge pages and locking asked for. Both are best effort and so,
+        // whether or not the machine obliges, the pool must behave the same.
+        options.alignment = size_t( 2 ) << 20;
+        options.hugePages = true;
+        options.preFault = true;
+        options.lockMemory = true;
+        retCode = runAcquireReleaseTest( options );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidReleaseTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file testChunkProducer.cpp
+ * @brief Test Chunk Producer Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorChunkProducer.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+    constexpr double retunedRadiansPerSample = -1.9;
+
+    // Some chunks serviced by the serial loops and some by the multi-lane kernels.
+    constexpr size_t CHUNK_SIZE = 200;
+    constexpr size_t NUM_CHUNKS = 4;
+    constexpr size_t CHUNKS_TO_CONSUME = 100;
+    constexpr size_t RETUNE_AT_CHUNK = 40;
+
+    // Spin until a chunk is ready, counting underruns as we go.
+    const FlyingPhasorElementType * waitForChunk( FlyingPhasorChunkProducer & producer, size_t & underruns )
+    {
+        const FlyingPhasorElementType * pChunk;
+        while ( nullptr == ( pChunk = producer.acquireChunk() ) )
+        {
+            ++underruns;
+            std::this_thread::yield();
+        }
+        return pChunk;
+    }
+
+    bool equal( const FlyingPhasorElementType * pA, const FlyingPhasorElementType * pB, size_t numSamples )
+    {
+        for ( size_t i = 0; numSamples != i; ++i )
+            if ( pA[ i ] != pB[ i ] ) return false;
+        return true;
+    }
+}
+
+int runChunkSequenceTest()
+{
+    FlyingPhasorChunkProducer producer{ radiansPerSample, phi, CHUNK_SIZE, NUM_CHUNKS };
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    std::unique_ptr< FlyingPhasorElementType[] > goldenBuf{new FlyingPhasorElementType[CHUNK_SIZE] };
+    std::unique_ptr< FlyingPhasorElementType[] > retunedBuf{new FlyingPhasorElementType[CHUNK_SIZE] };
+
+    size_t underruns = 0;
+    bool retuneApplied = false;
+    for ( size_t c = 0; CHUNKS_TO_CONSUME != c; ++c )
+    {
+        if ( RETUNE_AT_CHUNK == c )
+            producer.retune( retunedRadiansPerSample );
+
+        const auto pChunk = waitForChunk( producer, underruns );
+
+        // Acquiring again without releasing hands back the same chunk.
+        if ( pChunk != producer.acquireChunk() )
+        {
+            std::cout << "Acquiring twice returned different chunks at chunk " << c << std::endl;
+            return 1;
+        }
+
+        // The retune lands at the start of some chunk after it was posted, whichever one the producer began next.
+        // Until then, chunks must be what the tone generator delivers untouched and, after, what it delivers
+        // with the retune applied at the first sample.
+        auto retunedGen = goldenGen;
+        goldenGen.getSamples( goldenBuf.get(), CHUNK_SIZE );
+        if ( !equal( goldenBuf.get(), pChunk, CHUNK_SIZE ) )
+        {
+            const FlyingPhasorToneGenerator::Event retuneEvent{
+                    0, FlyingPhasorToneGenerator::EventType::Frequency, retunedRadiansPerSample };
+            retunedGen.getSamplesWithEvents( retunedBuf.get(), CHUNK_SIZE, &retuneEvent, 1 );
+            if ( retuneApplied || RETUNE_AT_CHUNK > c || !equal( retunedBuf.get(), pChunk, CHUNK_SIZE ) )
+            {
+                std::cout << "Chunk " << c << " differs from the tone generator" << std::endl;
+                return 2;
+            }
+            goldenGen = retunedGen;
+            retuneApplied = true;
+        }
+
+        producer.releaseChunk();
+    }
+
+    if ( !retuneApplied )
+    {
+        std::cout << "The retune was never applied" << std::endl;
+        return 3;
+    }
+    if ( underruns != producer.getUnderrunCount() )
+    {
+        std::cout << "Underrun count is " << producer.getUnderrunCount() << ", observed " << underruns << std::endl;
+        return 4;
+    }
+    if ( CHUNKS_TO_CONSUME > producer.getChunksProduced() ||
+         CHUNKS_TO_CONSUME + NUM_CHUNKS < producer.getChunksProduced() )
+    {
+        std::cout << "Chunks produced is " << producer.getChunksProduced() << std::endl;
+        return 5;
+    }
+
+    return 0;
+}
+
+int runInvalidArgumentTest()
+{
+    try
+    {
+        FlyingPhasorChunkProducer producer{ radiansPerSample, phi, 0, NUM_CHUNKS };
+        std::cout << "Zero chunk size was accepted" << std::endl;
+        return 11;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    try
+    {
+        FlyingPhasorChunkProducer producer{ radiansPerSample, phi, CHUNK_SIZE, 1 };
+        std::cout << "A single chunk was accepted" << std::endl;
+        return 12;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runChunkSequenceTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file testEvents.cpp
+ * @brief Test Event Timeline Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    using Event = FlyingPhasorToneGenerator::Event;
+    using EventType = FlyingPhasorToneGenerator::EventType;
+
+    constexpr size_t NUM_SAMPLES = 4000;
+    constexpr double radiansPerSample = 0.2;
+    constexpr double phi = 0.0;
+
+    // Stretches long enough for the multi-lane kernels and, short ones for the serial loops.
+    const Event events[] = {
+        { 1000, EventType::Frequency, -0.7 },
+        { 1010, EventType::Magnitude, 0.5 },
+        { 1010, EventType::PhaseShift, 1.0 },
+        { 2500, EventType::Phase, -2.0 },
+        { 2500, EventType::Frequency, 1.3 },
+        { 4000, EventType::Frequency, 0.1 }
+    };
+    constexpr size_t NUM_EVENTS = sizeof( events ) / sizeof( Event );
+}
+
+int runNoEventsTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    // Without events, we should get exactly what getSamplesScaled delivers.
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    goldenGen.getSamplesScaled( goldenElementBuf.get(), NUM_SAMPLES, 2.0 );
+    const auto mag = testGen.getSamplesWithEvents( testElementBuf.get(), NUM_SAMPLES, nullptr, 0, 2.0 );
+    if ( 2.0 != mag )
+    {
+        std::cout << "Magnitude returned should be 2.0 and is " << mag << std::endl;
+        return 1;
+    }
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        if ( goldenElementBuf[ i ] != testElementBuf[ i ] )
+        {
+            std::cout << "No event mismatch at index " << i << std::endl;
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+int runTimelineTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    const auto mag = testGen.getSamplesWithEvents( testElementBuf.get(), NUM_SAMPLES, events, NUM_EVENTS );
+    if ( 0.5 != mag )
+    {
+        std::cout << "Magnitude returned should be 0.5 and is " << mag << std::endl;
+        return 11;
+    }
+    if ( NUM_SAMPLES != testGen.getSampleCount() )
+    {
+        std::cout << "Sample count should be " << NUM_SAMPLES << " and is " << testGen.getSampleCount() << std::endl;
+        return 12;
+    }
+
+    // Up to the first event, nothing differs from an uneventful tone.
+    goldenGen.getSamples( goldenElementBuf.get(), 1000 );
+    for ( size_t i = 0; 1000 != i; ++i )
+    {
+        if ( goldenElementBuf[ i ] != testElementBuf[ i ] )
+        {
+            std::cout << "Pre-event mismatch at index " << i << std::endl;
+            return 13;
+        }
+    }
+
+    // The frequency hop is phase continuous. The first affected sample is the one that was due anyway.
+    if ( goldenGen.peekNextSample() != testElementBuf[ 1000 ] )
+    {
+        std::cout << "Frequency hop should be phase continuous" << std::endl;
+        return 14;
+    }
+
+    // Verify the rates, magnitudes and phases of each stretch.
+    struct Stretch { size_t begin; size_t end; double rate; double mag; };
+    const Stretch stretches[] = { { 0, 1000, 0.2, 1.0 }, { 1000, 1010, -0.7, 1.0 },
+                                  { 1010, 2500, -0.7, 0.5 }, { 2500, 4000, 1.3, 0.5 } };
+    for ( const auto & stretch : stretches )
+    {
+        for ( size_t i = stretch.begin; stretch.end != i; ++i )
+        {
+            if ( !inTolerance( std::abs( testElementBuf[ i ] ), stretch.mag, 1e-14 ) )
+            {
+                std::cout << "Magnitude at index " << i << " should be " << stretch.mag << " and is "
+                          << std::abs( testElementBuf[ i ] ) << std::endl;
+                return 15;
+            }
+            if ( stretch.begin != i &&
+                 !inTolerance( deltaAngle( std::arg( testElementBuf[ i - 1 ] ), std::arg( testElementBuf[ i ] ) ),
+                               stretch.rate, 1e-12 ) )
+            {
+                std::cout << "Rate at index " << i << " should be " << stretch.rate << std::endl;
+                return 16;
+            }
+        }
+    }
+
+    // The phase shift at 1010 is relative to where the phase would have been.
+    const auto expected1010 = std::arg( testElementBuf[ 1009 ] ) - 0.7 + 1.0;
+    if ( std::fabs( deltaAngle( expected1010, std::arg( testElementBuf[ 1010 ] ) ) ) > 1e-12 )
+    {
+        std::cout << "Phase shift at index 1010 is incorrect" << std::endl;
+        return 17;
+    }
+
+    // The phase at 2500 is absolute.
+    if ( !inTolerance( std::arg( testElementBuf[ 2500 ] ), -2.0, 1e-14 ) )
+    {
+        std::cout << "Phase at index 2500 should be -2.0 and is " << std::arg( testElementBuf[ 2500 ] ) << std::endl;
+        return 18;
+    }
+
+    // The event at NUM_SAMPLES takes effect upon the next invocation.
+    testGen.getSamples( testElementBuf.get(), 100 );
+    for ( size_t i = 1; 100 != i; ++i )
+    {
+        if ( !inTolerance( deltaAngle( std::arg( testElementBuf[ i - 1 ] ), std::arg( testElementBuf[ i ] ) ), 0.1, 1e-12 ) )
+        {
+            std::cout << "Rate after trailing event should be 0.1" << std::endl;
+            return 19;
+        }
+    }
+
+    return 0;
+}
+
+int runAccumulateTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    // Accumulating delivers what getting does, added on.
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    goldenGen.getSamplesWithEvents( goldenElementBuf.get(), NUM_SAMPLES, events, NUM_EVENTS, 3.0 );
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        testElementBuf[ i ] = FlyingPhasorElementType{ double( i ), 1.0 };
+    testGen.accumSamplesWithEvents( testElementBuf.get(), NUM_SAMPLES, events, NUM_EVENTS, 3.0 );
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        if ( FlyingPhasorElementType{ double( i ), 1.0 } + goldenElementBuf[ i ] != testElementBuf[ i ] )
+        {
+            std::cout << "Accumulate mismatch at index " << i << std::endl;
+            return 21;
+        }
+    }
+
+    return 0;
+}
+
+int runInvalidEventsTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    const auto nextSample = testGen.peekNextSample();
+
+    const Event unsorted[] = { { 10, EventType::Frequency, 0.1 }, { 5, EventType::Frequency, 0.2 } };
+    const Event beyond[] = { { NUM_SAMPLES + 1, EventType::Frequency, 0.1 } };
+    const Event * badTimelines[] = { unsorted, beyond };
+    const size_t badTimelineLengths[] = { 2, 1 };
+
+    for ( size_t t = 0; 2 != t; ++t )
+    {
+        try
+        {
+            testGen.getSamplesWithEvents( testElementBuf.get(), NUM_SAMPLES, badTimelines[ t ], badTimelineLengths[ t ] );
+            std::cout << "Invalid timeline " << t << " should throw std::invalid_argument" << std::endl;
+            return 31;
+        }
+        catch ( const std::invalid_argument & )
+        {
+        }
+    }
+
+    if ( 0 != testGen.getSampleCount() || nextSample != testGen.peekNextSample() )
+    {
+        std::cout << "Invalid timelines should leave the instance unchanged" << std::endl;
+        return 32;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        retCode = runNoEventsTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runTimelineTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runAccumulateTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidEventsTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
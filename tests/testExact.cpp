@@ -0,0 +1,192 @@
+/**
+ * @file testExact.cpp
+ * @brief Test Exact Tone Generator Functionality
+ *
+ * The rate used here has only 21 significant bits so that, for the sample counts used, n times the rate is
+ * exact in extended precision (and in double precision, up to 2^32 samples). References formed from it do
+ * not accumulate error of their own.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorExactToneGenerator.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 1258291.0 / 4194304.0;
+    constexpr double phi = 0.7;
+
+    constexpr size_t ANCHOR_PERIOD = 65536;
+    constexpr size_t LONG_RUN = size_t( 1 ) << 27;
+
+    // Neither a divisor nor a multiple of the anchor period, so that requests straddle anchors.
+    constexpr size_t CHUNK_SIZE = 5000;
+
+    // Phase error over a single anchor period is a small multiple of the period times the rate's rounding error.
+    constexpr double maxAnchoredError = 1e-11;
+
+    // The exact sample at index n, in extended precision.
+    std::complex< long double > exactSample( size_t n )
+    {
+        const long double theta = (long double)n * radiansPerSample;
+        return std::polar( 1.0L, theta ) * std::polar( 1.0L, (long double)phi );
+    }
+
+    double errorOf( const FlyingPhasorElementType & sample, size_t n )
+    {
+        const auto exact = exactSample( n );
+        return double( std::abs( std::complex< long double >{ sample.real(), sample.imag() } - exact ) );
+    }
+}
+
+int runBeforeFirstAnchorTest()
+{
+    // With an anchor period longer than the run, every sample must be the tone generator's, for every operation.
+    constexpr size_t requestSizes[] = { 10, 1000, 33, 4097, 128, 1, 12345, 512 };
+    constexpr size_t MAX_REQUEST = 12345;
+    std::unique_ptr< FlyingPhasorElementType[] > goldenBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorElementType[] > testBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+
+    for ( int op = 0; 4 != op; ++op )
+    {
+        FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+        FlyingPhasorExactToneGenerator testGen{ radiansPerSample, phi, LONG_RUN };
+        for ( auto n : requestSizes )
+        {
+            for ( size_t i = 0; n != i; ++i )
+                goldenBuf[ i ] = testBuf[ i ] = FlyingPhasorElementType{ 0.25, -0.5 };
+
+            switch ( op )
+            {
+                case 0: goldenGen.getSamples( goldenBuf.get(), n ); testGen.getSamples( testBuf.get(), n ); break;
+                case 1: goldenGen.getSamplesScaled( goldenBuf.get(), n, 3.0 );
+                        testGen.getSamplesScaled( testBuf.get(), n, 3.0 ); break;
+                case 2: goldenGen.accumSamples( goldenBuf.get(), n ); testGen.accumSamples( testBuf.get(), n ); break;
+                default: goldenGen.accumSamplesScaled( goldenBuf.get(), n, 3.0 );
+                         testGen.accumSamplesScaled( testBuf.get(), n, 3.0 ); break;
+            }
+
+            for ( size_t i = 0; n != i; ++i )
+            {
+                if ( goldenBuf[ i ] != testBuf[ i ] )
+                {
+                    std::cout << "Operation " << op << " differs at sample " << i << " of a request for " << n
+                              << std::endl;
+                    return 1;
+                }
+            }
+        }
+        if ( goldenGen.getSampleCount() != testGen.getSampleCount() )
+        {
+            std::cout << "Sample count is " << testGen.getSampleCount() << ", expected "
+                      << goldenGen.getSampleCount() << std::endl;
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+int runLongHorizonTest()
+{
+    FlyingPhasorToneGenerator plainGen{ radiansPerSample, phi };
+    FlyingPhasorExactToneGenerator testGen{ radiansPerSample, phi, ANCHOR_PERIOD };
+    std::unique_ptr< FlyingPhasorElementType[] > buf{new FlyingPhasorElementType[CHUNK_SIZE] };
+
+    double maxError = 0.0;
+    size_t n = 0;
+    while ( LONG_RUN > n )
+    {
+        testGen.getSamples( buf.get(), CHUNK_SIZE );
+        plainGen.getSamples( buf.get(), CHUNK_SIZE );
+        n += CHUNK_SIZE;
+
+        maxError = std::max( maxError, errorOf( testGen.peekNextSample(), n ) );
+
+        // The unwrapped phase is exact, rounded once. Here, n times the rate is exact in double precision.
+        if ( double( n ) * radiansPerSample + phi != testGen.getUnwrappedPhase() )
+        {
+            std::cout << "Unwrapped phase is " << testGen.getUnwrappedPhase() << " at sample " << n << std::endl;
+            return 11;
+        }
+    }
+
+    std::cout << "Over " << n << " samples, anchored error peaked at " << maxError << " and, unanchored error ended at "
+              << errorOf( plainGen.peekNextSample(), n ) << std::endl;
+    if ( maxAnchoredError < maxError )
+        return 12;
+
+    return 0;
+}
+
+int runSeekTest()
+{
+    FlyingPhasorExactToneGenerator testGen{ radiansPerSample, phi, ANCHOR_PERIOD };
+    for ( size_t n : { LONG_RUN, size_t( 12345 ), size_t( 0 ), LONG_RUN * 64 + 7 } )
+    {
+        testGen.seek( n );
+        const double error = errorOf( testGen.peekNextSample(), n );
+        if ( 1e-15 < error || n != testGen.getSampleCount() )
+        {
+            std::cout << "Seeking to " << n << " left an error of " << error << std::endl;
+            return 21;
+        }
+    }
+
+    return 0;
+}
+
+int runInvalidArgumentTest()
+{
+    try
+    {
+        FlyingPhasorExactToneGenerator testGen{ radiansPerSample, phi, 0 };
+        std::cout << "An anchor period of zero was accepted" << std::endl;
+        return 31;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runBeforeFirstAnchorTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runLongHorizonTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runSeekTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,280 @@
+/**
+ * @file testFixedPoint.cpp
+ * @brief Test Fixed Point (SC16 and SC8) Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 2000;    // Not a multiple of any internal chunk size.
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    // The golden standard is complex samples from a twin generator, scaled and rounded by hand.
+    // Internally, fixed point samples are generated a chunk at a time, which may differ from
+    // the twin by the odd double precision ULP. That can only tip a rounding that was sitting right on
+    // a half LSB boundary so, we allow one LSB of difference.
+    template< typename T >
+    int compareToGolden( const T * pIQ, const FlyingPhasorElementType * pGolden, const double * pPrior,
+                         double gain, double maxDiff )
+    {
+        for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+        {
+            const double component = 0 == i % 2 ? pGolden[ i / 2 ].real() : pGolden[ i / 2 ].imag();
+            const double expected = std::round( component * gain + ( pPrior ? pPrior[ i ] : 0.0 ) );
+            if ( std::fabs( expected - double( pIQ[ i ] ) ) > maxDiff )
+            {
+                std::cout << "Component " << i << " is " << int( pIQ[ i ] ) << ", expected " << expected << std::endl;
+                return 1;
+            }
+        }
+        return 0;
+    }
+}
+
+int runSC16Test()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorSC16Type[] > testIQBuf{new FlyingPhasorSC16Type[2 * NUM_SAMPLES] };
+    std::unique_ptr< double[] > priorBuf{new double[2 * NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+    // Get, at half of full scale.
+    constexpr double fullScaleGain = 0.5;
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.getSamplesSC16( testIQBuf.get(), NUM_SAMPLES, fullScaleGain );
+    if ( 0 != compareToGolden( testIQBuf.get(), goldenElementBuf.get(), nullptr, fullScaleGain * 32767, 1.0 ) )
+    {
+        std::cout << "Failed getSamplesSC16 test" << std::endl;
+        return 1;
+    }
+    if ( goldenGen.getSampleCount() != testGen.getSampleCount() )
+    {
+        std::cout << "Failed getSamplesSC16 sample count test" << std::endl;
+        return 2;
+    }
+
+    // Accumulate on top of that. The phase picks up right where it left off.
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+        priorBuf[ i ] = testIQBuf[ i ];
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.accumSamplesSC16( testIQBuf.get(), NUM_SAMPLES, fullScaleGain / 2 );
+    if ( 0 != compareToGolden( testIQBuf.get(), goldenElementBuf.get(), priorBuf.get(), fullScaleGain / 2 * 32767, 1.0 ) )
+    {
+        std::cout << "Failed accumSamplesSC16 test" << std::endl;
+        return 3;
+    }
+
+    // Well beyond full scale, samples must saturate rather than wrap around. We should see the rails and,
+    // the sign of every component should agree with that of its complex counterpart.
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.getSamplesSC16( testIQBuf.get(), NUM_SAMPLES, 4.0 );
+    bool sawPosRail = false;
+    bool sawNegRail = false;
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+    {
+        const double component = 0 == i % 2 ? goldenElementBuf[ i / 2 ].real() : goldenElementBuf[ i / 2 ].imag();
+        if ( 32767 == testIQBuf[ i ] ) sawPosRail = true;
+        if ( -32768 == testIQBuf[ i ] ) sawNegRail = true;
+        if ( std::fabs( component ) > 0.01 && std::signbit( component ) != ( testIQBuf[ i ] < 0 ) )
+        {
+            std::cout << "Saturation failure at component " << i << ", value " << testIQBuf[ i ] << std::endl;
+            return 4;
+        }
+    }
+    if ( !sawPosRail || !sawNegRail )
+    {
+        std::cout << "Failed to saturate at the rails" << std::endl;
+        return 5;
+    }
+
+    return 0;
+}
+
+int runSC8Test()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorSC8Type[] > testIQBuf{new FlyingPhasorSC8Type[2 * NUM_SAMPLES] };
+    std::unique_ptr< double[] > priorBuf{new double[2 * NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+    constexpr double fullScaleGain = 0.75;
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.getSamplesSC8( testIQBuf.get(), NUM_SAMPLES, fullScaleGain );
+    if ( 0 != compareToGolden( testIQBuf.get(), goldenElementBuf.get(), nullptr, fullScaleGain * 127, 1.0 ) )
+    {
+        std::cout << "Failed getSamplesSC8 test" << std::endl;
+        return 11;
+    }
+
+    // Accumulating another 75% of full scale will saturate at the peaks.
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+        priorBuf[ i ] = testIQBuf[ i ];
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.accumSamplesSC8( testIQBuf.get(), NUM_SAMPLES, fullScaleGain );
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+    {
+        const double component = 0 == i % 2 ? goldenElementBuf[ i / 2 ].real() : goldenElementBuf[ i / 2 ].imag();
+        const double expected = std::max( -128.0, std::min( 127.0, std::round( priorBuf[ i ] + component * fullScaleGain * 127 ) ) );
+        if ( std::fabs( expected - double( testIQBuf[ i ] ) ) > 1.0 )
+        {
+            std::cout << "Failed accumSamplesSC8 test at component " << i << ", value " << int( testIQBuf[ i ] )
+                      << ", expected " << expected << std::endl;
+            return 12;
+        }
+    }
+
+    return 0;
+}
+
+int runDitherTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorSC16Type[] > testIQBuf{new FlyingPhasorSC16Type[2 * NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+    // With dither, the error relative to the exact scaled value is the sum of triangular dither (+/- 1 LSB,
+    // variance 1/6) and rounding (+/- 1/2 LSB, variance 1/12). Its mean should be near zero, its variance
+    // near 1/4 and, it can never exceed 1.5 LSBs.
+    constexpr double fullScaleGain = 0.5;
+    constexpr double gain = fullScaleGain * 32767;
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.getSamplesSC16( testIQBuf.get(), NUM_SAMPLES, fullScaleGain, true );
+
+    double sum = 0.0;
+    double sumSq = 0.0;
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+    {
+        const double component = 0 == i % 2 ? goldenElementBuf[ i / 2 ].real() : goldenElementBuf[ i / 2 ].imag();
+        const double error = double( testIQBuf[ i ] ) - component * gain;
+        if ( std::fabs( error ) > 1.5 )
+        {
+            std::cout << "Dither error exceeds 1.5 LSB at component " << i << ": " << error << std::endl;
+            return 21;
+        }
+        sum += error;
+        sumSq += error * error;
+    }
+    const double mean = sum / ( 2 * NUM_SAMPLES );
+    const double variance = sumSq / ( 2 * NUM_SAMPLES ) - mean * mean;
+    if ( std::fabs( mean ) > 0.05 || std::fabs( variance - 0.25 ) > 0.05 )
+    {
+        std::cout << "Dither statistics are off. Mean: " << mean << ", Variance: " << variance << std::endl;
+        return 22;
+    }
+
+    // Successive invocations must not repeat the same dither. With a DC tone, the undithered
+    // samples would be identical from one invocation to the next.
+    FlyingPhasorToneGenerator dcGen{ 0.0, 0.0 };
+    std::unique_ptr< FlyingPhasorSC16Type[] > secondIQBuf{new FlyingPhasorSC16Type[2 * NUM_SAMPLES] };
+    dcGen.getSamplesSC16( testIQBuf.get(), NUM_SAMPLES, 0.1, true );
+    dcGen.getSamplesSC16( secondIQBuf.get(), NUM_SAMPLES, 0.1, true );
+    size_t numSame = 0;
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+        if ( testIQBuf[ i ] == secondIQBuf[ i ] ) ++numSame;
+    if ( 2 * NUM_SAMPLES == numSame )
+    {
+        std::cout << "Dither repeated itself across invocations" << std::endl;
+        return 23;
+    }
+
+    return 0;
+}
+
+int runNotFiniteTest()
+{
+    // A gain that is not finite has no integer samples to deliver. It must be rejected without disturbing
+    // what the buffer already holds (accumulating) and, without advancing the generator.
+    std::unique_ptr< FlyingPhasorSC16Type[] > iq16Buf{new FlyingPhasorSC16Type[2 * NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorSC8Type[] > iq8Buf{new FlyingPhasorSC8Type[2 * NUM_SAMPLES] };
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+    {
+        iq16Buf[ i ] = FlyingPhasorSC16Type( 1000 + i );
+        iq8Buf[ i ] = FlyingPhasorSC8Type( 1 + i % 100 );
+    }
+
+    FlyingPhasorToneGenerator gen{ radiansPerSample, phi };
+    const double gains[] = { std::nan( "" ), HUGE_VAL, -HUGE_VAL, 1e308 };
+    for ( const double gain : gains )
+    {
+        try
+        {
+            gen.accumSamplesSC16( iq16Buf.get(), NUM_SAMPLES, gain );
+            std::cout << "accumSamplesSC16 accepted a gain of " << gain << std::endl;
+            return 31;
+        }
+        catch ( const std::invalid_argument & ) {}
+
+        try
+        {
+            gen.accumSamplesSC8( iq8Buf.get(), NUM_SAMPLES, gain, true );
+            std::cout << "accumSamplesSC8 accepted a gain of " << gain << std::endl;
+            return 32;
+        }
+        catch ( const std::invalid_argument & ) {}
+
+        try
+        {
+            gen.getSamplesSC16( iq16Buf.get(), NUM_SAMPLES, gain );
+            std::cout << "getSamplesSC16 accepted a gain of " << gain << std::endl;
+            return 33;
+        }
+        catch ( const std::invalid_argument & ) {}
+    }
+
+    for ( size_t i = 0; 2 * NUM_SAMPLES != i; ++i )
+    {
+        if ( FlyingPhasorSC16Type( 1000 + i ) != iq16Buf[ i ] || FlyingPhasorSC8Type( 1 + i % 100 ) != iq8Buf[ i ] )
+        {
+            std::cout << "Component " << i << " was disturbed" << std::endl;
+            return 34;
+        }
+    }
+
+    return 0 == gen.getSampleCount() ? 0 : 35;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    do
+    {
+        retCode = runSC16Test();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runSC8Test();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runDitherTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runNotFiniteTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
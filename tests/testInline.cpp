@@ -0,0 +1,154 @@
+/**
+ * @file testInline.cpp
+ * @brief Test Inline (Header Only) Tone Generator Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorInline.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 4099;    // Odd, so requests straddle period boundaries.
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+}
+
+int runMatchesGetSampleTest()
+{
+    // With the default period, every operation must reproduce FlyingPhasorToneGenerator::getSample
+    // bit for bit, whatever the request sizes.
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGeneratorInline<> testGen{ radiansPerSample, phi };
+
+    const size_t requestSizes[] = { 1, 2, 3, 7, 64, 1000, NUM_SAMPLES };
+    for ( size_t numSamples : requestSizes )
+    {
+        testGen.getSamples( testElementBuf.get(), numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( goldenGen.getSample() != testElementBuf[ i ] )
+            {
+                std::cout << "getSamples request of " << numSamples << " differs at sample " << i << std::endl;
+                return 1;
+            }
+        }
+
+        testGen.getSamplesScaled( testElementBuf.get(), numSamples, 2.5 );
+        testGen.accumSamplesScaled( testElementBuf.get(), numSamples, 0.5 );
+        testGen.accumSamples( testElementBuf.get(), numSamples );
+        std::unique_ptr< FlyingPhasorElementType[] > expected{new FlyingPhasorElementType[numSamples] };
+        for ( size_t i = 0; numSamples != i; ++i ) expected[ i ] = goldenGen.getSample() * 2.5;
+        for ( size_t i = 0; numSamples != i; ++i ) expected[ i ] += goldenGen.getSample() * 0.5;
+        for ( size_t i = 0; numSamples != i; ++i ) expected[ i ] += goldenGen.getSample();
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( expected[ i ] != testElementBuf[ i ] )
+            {
+                std::cout << "Scaled/accumulated request of " << numSamples << " differs at sample " << i << std::endl;
+                return 2;
+            }
+        }
+
+        if ( goldenGen.getSampleCount() != testGen.getSampleCount() || goldenGen.getSample() != testGen.getSample() )
+        {
+            std::cout << "State differs after request of " << numSamples << std::endl;
+            return 3;
+        }
+    }
+
+    testGen.reset( -radiansPerSample, -phi );
+    goldenGen.reset( -radiansPerSample, -phi );
+    if ( 0 != testGen.getSampleCount() || goldenGen.peekNextSample() != testGen.peekNextSample() )
+    {
+        std::cout << "Reset state differs" << std::endl;
+        return 4;
+    }
+
+    return 0;
+}
+
+template< size_t NormalizationPeriod, typename NormalizationPolicy = FirstOrderTaylorNormalization >
+int runPeriodPurityTest( int failCode )
+{
+    // Longer periods let magnitude error build for longer between normalizations, by about an ULP
+    // per sample. Phase error is dominated by the rounding of the rate and, does not depend on the period.
+    constexpr size_t numSamples = 1000000;
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[numSamples] };
+
+    FlyingPhasorToneGeneratorInline< NormalizationPeriod, NormalizationPolicy > testGen{ radiansPerSample, phi };
+    testGen.getSamples( testElementBuf.get(), numSamples );
+
+    double maxMagError = 0.0;
+    double maxPhaseError = 0.0;
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        const auto ideal = std::polar( 1.0L, phi + (long double)i * radiansPerSample );
+        const std::complex< long double > sample{ testElementBuf[ i ].real(), testElementBuf[ i ].imag() };
+        maxMagError = std::max( maxMagError, double( std::fabs( std::abs( sample ) - 1.0L ) ) );
+        maxPhaseError = std::max( maxPhaseError, double( std::fabs( std::arg( sample * std::conj( ideal ) ) ) ) );
+    }
+
+    const double magTolerance = 1e-16 * double( NormalizationPeriod + 4 );
+    if ( maxMagError > magTolerance || maxPhaseError > 1e-10 )
+    {
+        std::cout << "Period " << NormalizationPeriod << " max magnitude error " << maxMagError
+                  << ", max phase error " << maxPhaseError << std::endl;
+        return failCode;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runMatchesGetSampleTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 1 >( 11 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 2 >( 12 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 16 >( 13 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 256 >( 14 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 256, SecondOrderTaylorNormalization >( 15 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPeriodPurityTest< 256, ExactNormalization >( 16 );
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file testInstrumentation.cpp
+ * @brief Test Instrumentation Counter Functionality
+ *
+ * Built without REISER_RT_FLYING_PHASOR_INSTRUMENTATION, every counter must read zero whatever is done.
+ * Built with it, every counter must read exactly what was done.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+#ifdef REISER_RT_FLYING_PHASOR_INSTRUMENTATION
+    constexpr size_t instrumented = 1;
+#else
+    constexpr size_t instrumented = 0;
+#endif
+
+    // Large enough for the parallel operation to use four segments.
+    constexpr size_t PARALLEL_SIZE = 4 * 65536;
+
+    using Op = FlyingPhasorToneGenerator::InstrumentedOperation;
+
+    bool countsAre( const FlyingPhasorToneGenerator::Instrumentation & instrumentation,
+                    const size_t ( &expected )[ int( Op::Count ) ], size_t renormalizations )
+    {
+        for ( int op = 0; int( Op::Count ) != op; ++op )
+        {
+            if ( instrumented * expected[ op ] != instrumentation.samples[ op ] )
+            {
+                std::cout << "Operation " << op << " counted " << instrumentation.samples[ op ]
+                          << " samples, expected " << instrumented * expected[ op ] << std::endl;
+                return false;
+            }
+        }
+        if ( instrumented * renormalizations != instrumentation.renormalizations )
+        {
+            std::cout << "Counted " << instrumentation.renormalizations << " renormalizations, expected "
+                      << instrumented * renormalizations << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int runCountTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > buf{new FlyingPhasorElementType[PARALLEL_SIZE] };
+    FlyingPhasorToneGenerator gen{ radiansPerSample, phi };
+
+    // Serially, every other sample is renormalized.
+    gen.getSamples( buf.get(), 100 );
+    gen.getSamplesScaled( buf.get(), 10, 2.0 );
+    gen.accumSamplesScaled( buf.get(), 20, 0.5 );
+    for ( int i = 0; 3 != i; ++i )
+        gen.getSample();
+    if ( !countsAre( gen.getInstrumentation(), { 100, 10, 0, 0, 20, 0, 3 }, 66 ) )
+        return 1;
+
+    // The kernels renormalize once per whole block of 32 samples.
+    gen.getSamples( buf.get(), 1000 );
+    gen.accumSamples( buf.get(), 128 );
+    if ( !countsAre( gen.getInstrumentation(), { 1100, 10, 0, 128, 20, 0, 3 }, 66 + 31 + 4 ) )
+        return 2;
+
+    // Composite operations count as the operations they are built upon. Here, Get.
+    gen.resetInstrumentation();
+    gen.mixSamples( buf.get(), 50 );
+    if ( !countsAre( gen.getInstrumentation(), { 50, 0, 0, 0, 0, 0, 0 }, 25 ) )
+        return 3;
+
+    // The magnitude error before correction is tiny but not zero.
+    const double worst = gen.getInstrumentation().worstMagnitudeError;
+    if ( ( instrumented && ( 0.0 == worst || 1e-14 < worst ) ) || ( !instrumented && 0.0 != worst ) )
+    {
+        std::cout << "Worst magnitude error is " << worst << std::endl;
+        return 4;
+    }
+
+    // Nothing counted on other threads may be lost.
+    gen.resetInstrumentation();
+    gen.getSamplesParallel( buf.get(), PARALLEL_SIZE, 4 );
+    if ( !countsAre( gen.getInstrumentation(), { PARALLEL_SIZE, 0, 0, 0, 0, 0, 0 }, PARALLEL_SIZE / 32 ) )
+        return 5;
+
+    // Neither reset nor seek disturbs the counters. Only resetInstrumentation does.
+    gen.reset( radiansPerSample, phi );
+    gen.seek( 12345 );
+    if ( !countsAre( gen.getInstrumentation(), { PARALLEL_SIZE, 0, 0, 0, 0, 0, 0 }, PARALLEL_SIZE / 32 ) )
+        return 6;
+    gen.resetInstrumentation();
+    if ( !countsAre( gen.getInstrumentation(), { 0, 0, 0, 0, 0, 0, 0 }, 0 ) ||
+         0.0 != gen.getInstrumentation().worstMagnitudeError )
+        return 7;
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runCountTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
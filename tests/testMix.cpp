@@ -0,0 +1,288 @@
+/**
+ * @file testMix.cpp
+ * @brief Test Mixing and Digital Down Conversion Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+#include "FlyingPhasorDownConverter.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 5000;    // Several internal chunks and, not a multiple of any.
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    // Mixing generates its tone a chunk at a time, which may differ from one large getSamples request by
+    // the odd ULP.
+    constexpr double maxDiff = 1e-13;
+
+    // Some input to mix. A tone of its own, with a little amplitude modulation so that it is not unit magnitude.
+    void makeInput( FlyingPhasorElementType * pInput, size_t numSamples )
+    {
+        FlyingPhasorToneGenerator inputGen{ 0.35, -0.2 };
+        inputGen.getSamples( pInput, numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+            pInput[ i ] *= 1.0 + 0.5 * std::sin( 0.001 * double( i ) );
+    }
+
+    // Requests of assorted sizes, summing to NUM_SAMPLES.
+    const size_t requestSizes[] = { 1, 7, 600, 1024, 3, 2365, 1000 };
+}
+
+int runMixTest( bool conjugate, bool inPlace, int failCode )
+{
+    std::unique_ptr< FlyingPhasorElementType[] > inputBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > toneBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    makeInput( inputBuf.get(), NUM_SAMPLES );
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    goldenGen.getSamples( toneBuf.get(), NUM_SAMPLES );
+
+    if ( inPlace )
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i ) testBuf[ i ] = inputBuf[ i ];
+
+    // The phase must carry across requests.
+    size_t offset = 0;
+    for ( size_t numSamples : requestSizes )
+    {
+        if ( inPlace )
+            testGen.mixSamples( testBuf.get() + offset, numSamples, conjugate );
+        else
+            testGen.mixSamples( inputBuf.get() + offset, testBuf.get() + offset, numSamples, conjugate );
+        offset += numSamples;
+    }
+
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        const auto expected = inputBuf[ i ] * ( conjugate ? std::conj( toneBuf[ i ] ) : toneBuf[ i ] );
+        if ( std::abs( expected - testBuf[ i ] ) > maxDiff )
+        {
+            std::cout << "Mix (conjugate " << conjugate << ", in place " << inPlace << ") differs at sample " << i
+                      << " by " << std::abs( expected - testBuf[ i ] ) << std::endl;
+            return failCode;
+        }
+    }
+    if ( NUM_SAMPLES != testGen.getSampleCount() )
+    {
+        std::cout << "Mix sample count is " << testGen.getSampleCount() << std::endl;
+        return failCode + 1;
+    }
+
+    return 0;
+}
+
+int runDownConverterTest( FlyingPhasorDownConverter & ddc, const std::vector< double > & taps, int failCode )
+{
+    // The golden standard is the brute force route. Mix the whole input with the conjugate tone,
+    // convolve with the taps, zero before the first sample and, keep every decimation'th output.
+    std::unique_ptr< FlyingPhasorElementType[] > inputBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > mixedBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    makeInput( inputBuf.get(), NUM_SAMPLES );
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    goldenGen.getSamples( mixedBuf.get(), NUM_SAMPLES );
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        mixedBuf[ i ] = inputBuf[ i ] * std::conj( mixedBuf[ i ] );
+
+    const size_t decimation = ddc.getDecimation();
+    std::vector< FlyingPhasorElementType > golden{};
+    for ( size_t n = 0; NUM_SAMPLES > n; n += decimation )
+    {
+        FlyingPhasorElementType sum{};
+        for ( size_t k = 0; taps.size() != k && k <= n; ++k )
+            sum += taps[ k ] * mixedBuf[ n - k ];
+        golden.push_back( sum );
+    }
+
+    // Process in requests of assorted sizes.
+    std::unique_ptr< FlyingPhasorElementType[] > outputBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    size_t offset = 0;
+    size_t numOutput = 0;
+    for ( size_t numSamples : requestSizes )
+    {
+        numOutput += ddc.process( inputBuf.get() + offset, numSamples, outputBuf.get() + numOutput );
+        offset += numSamples;
+    }
+
+    if ( golden.size() != numOutput )
+    {
+        std::cout << "Down converter delivered " << numOutput << " samples, expected " << golden.size() << std::endl;
+        return failCode;
+    }
+    for ( size_t m = 0; numOutput != m; ++m )
+    {
+        if ( std::abs( golden[ m ] - outputBuf[ m ] ) > maxDiff )
+        {
+            std::cout << "Down converter output " << m << " differs by " << std::abs( golden[ m ] - outputBuf[ m ] )
+                      << std::endl;
+            return failCode + 1;
+        }
+    }
+
+    return 0;
+}
+
+int runFirDownConverterTest()
+{
+    // A windowed sinc low pass, cut off at a quarter of the output band.
+    constexpr size_t decimation = 8;
+    constexpr size_t numTaps = 63;
+    std::vector< double > taps( numTaps );
+    double sum = 0.0;
+    for ( size_t k = 0; numTaps != k; ++k )
+    {
+        const double x = double( k ) - double( numTaps - 1 ) / 2.0;
+        const double cutoff = M_PI / double( 2 * decimation );
+        const double sinc = 0.0 == x ? cutoff / M_PI : std::sin( cutoff * x ) / ( M_PI * x );
+        const double hamming = 0.54 - 0.46 * std::cos( 2.0 * M_PI * double( k ) / double( numTaps - 1 ) );
+        taps[ k ] = sinc * hamming;
+        sum += taps[ k ];
+    }
+    for ( auto & tap : taps )
+        tap /= sum;
+
+    FlyingPhasorDownConverter ddc{ radiansPerSample, decimation, taps.data(), numTaps, phi };
+    if ( numTaps != ddc.getNumTaps() )
+    {
+        std::cout << "FIR down converter reports " << ddc.getNumTaps() << " taps" << std::endl;
+        return 21;
+    }
+    auto retCode = runDownConverterTest( ddc, taps, 22 );
+    if ( 0 != retCode )
+        return retCode;
+
+    // After a reset, it must do it all again just the same.
+    ddc.reset( phi );
+    return runDownConverterTest( ddc, taps, 24 );
+}
+
+int runCicDownConverterTest()
+{
+    // The taps of a CIC are the coefficients of ( 1 + z^-1 + ... + z^-(R-1) )^N over R^N.
+    constexpr size_t decimation = 5;
+    constexpr unsigned int cicOrder = 3;
+    std::vector< double > taps{ 1.0 };
+    for ( unsigned int stage = 0; cicOrder != stage; ++stage )
+    {
+        std::vector< double > next( taps.size() + decimation - 1, 0.0 );
+        for ( size_t i = 0; taps.size() != i; ++i )
+            for ( size_t j = 0; decimation != j; ++j )
+                next[ i + j ] += taps[ i ] / decimation;
+        taps.swap( next );
+    }
+
+    FlyingPhasorDownConverter ddc{ radiansPerSample, decimation, cicOrder, phi };
+    if ( taps.size() != ddc.getNumTaps() )
+    {
+        std::cout << "CIC down converter reports " << ddc.getNumTaps() << " taps" << std::endl;
+        return 31;
+    }
+    auto retCode = runDownConverterTest( ddc, taps, 32 );
+    if ( 0 != retCode )
+        return retCode;
+
+    // A tone right at the mixing frequency comes out at DC with unity gain, once the filter has filled.
+    FlyingPhasorDownConverter dcDdc{ radiansPerSample, decimation, cicOrder };
+    FlyingPhasorToneGenerator toneGen{ radiansPerSample, phi };
+    std::unique_ptr< FlyingPhasorElementType[] > inputBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > outputBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    toneGen.getSamples( inputBuf.get(), NUM_SAMPLES );
+    const size_t numOutput = dcDdc.process( inputBuf.get(), NUM_SAMPLES, outputBuf.get() );
+    const auto expected = std::polar( 1.0, phi );
+    for ( size_t m = taps.size() / decimation + 1; numOutput != m; ++m )
+    {
+        if ( std::abs( outputBuf[ m ] - expected ) > 1e-12 )
+        {
+            std::cout << "CIC DC output " << m << " is " << outputBuf[ m ] << ", expected " << expected << std::endl;
+            return 34;
+        }
+    }
+
+    return 0;
+}
+
+int runInvalidArgumentTest()
+{
+    const double tap = 1.0;
+    try
+    {
+        FlyingPhasorDownConverter ddc{ radiansPerSample, 0, &tap, 1 };
+        std::cout << "Zero decimation was accepted" << std::endl;
+        return 41;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    try
+    {
+        FlyingPhasorDownConverter ddc{ radiansPerSample, 4, &tap, 0 };
+        std::cout << "Zero taps were accepted" << std::endl;
+        return 42;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    try
+    {
+        FlyingPhasorDownConverter ddc{ radiansPerSample, 4, 0U };
+        std::cout << "Zero CIC order was accepted" << std::endl;
+        return 43;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runMixTest( false, false, 1 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runMixTest( true, false, 3 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runMixTest( false, true, 5 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runMixTest( true, true, 7 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runFirDownConverterTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runCicDownConverterTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
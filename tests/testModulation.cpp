@@ -0,0 +1,169 @@
+/**
+ * @file testModulation.cpp
+ * @brief Test Modulation Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 5000;    // Several internal chunks and, not a multiple of any.
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+    constexpr double maxDiff = 1e-13;
+}
+
+int runPhaseModulationTest( bool accumulate, int failCode )
+{
+    std::unique_ptr< FlyingPhasorElementType[] > carrierBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< double[] > phases{new double[NUM_SAMPLES] };
+
+    // Smooth modulation for the most part, which rotates. With some abrupt jumps here and there,
+    // which re-anchor.
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        phases[ i ] = 2.5 * std::sin( 0.01 * double( i ) ) + ( 0 == ( i / 777 ) % 2 ? 0.0 : 1.0 );
+
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    goldenGen.getSamples( carrierBuf.get(), NUM_SAMPLES );
+
+    const FlyingPhasorElementType prior{ 0.25, -0.5 };
+    if ( accumulate )
+    {
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i ) testBuf[ i ] = prior;
+        testGen.accumSamplesPhaseModulated( testBuf.get(), NUM_SAMPLES, phases.get() );
+    }
+    else
+        testGen.getSamplesPhaseModulated( testBuf.get(), NUM_SAMPLES, phases.get() );
+
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        auto expected = carrierBuf[ i ] * std::polar( 1.0, phases[ i ] );
+        if ( accumulate ) expected += prior;
+        if ( std::abs( expected - testBuf[ i ] ) > maxDiff )
+        {
+            std::cout << "Phase modulation (accumulate " << accumulate << ") differs at sample " << i
+                      << " by " << std::abs( expected - testBuf[ i ] ) << std::endl;
+            return failCode;
+        }
+    }
+
+    // The carrier must carry on undisturbed.
+    if ( goldenGen.getSampleCount() != testGen.getSampleCount() ||
+         std::abs( goldenGen.peekNextSample() - testGen.peekNextSample() ) > maxDiff )
+    {
+        std::cout << "Phase modulation (accumulate " << accumulate << ") disturbed the carrier" << std::endl;
+        return failCode + 1;
+    }
+
+    return 0;
+}
+
+int runFrequencyModulationTest( bool accumulate, double deviation, int failCode )
+{
+    std::unique_ptr< FlyingPhasorElementType[] > testBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< double[] > rates{new double[NUM_SAMPLES] };
+
+    // Sinusoidal FM about the carrier for the most part, with a hop well away from it in the middle,
+    // which re-anchors every sample. Narrow deviations are rotated by a shorter series than wide ones.
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        rates[ i ] = radiansPerSample + deviation * std::sin( 0.003 * double( i ) ) +
+                     ( 2000 <= i && 2100 > i ? 1.5 : 0.0 );
+
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    const FlyingPhasorElementType prior{ 0.25, -0.5 };
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i ) testBuf[ i ] = accumulate ? prior : FlyingPhasorElementType{};
+
+    // In requests of assorted sizes. Phase must carry across them.
+    const size_t requestSizes[] = { 1, 7, 600, 1024, 3, 2365, 1000 };
+    size_t offset = 0;
+    for ( size_t numSamples : requestSizes )
+    {
+        if ( accumulate )
+            testGen.accumSamplesFrequencyModulated( testBuf.get() + offset, numSamples, rates.get() + offset );
+        else
+            testGen.getSamplesFrequencyModulated( testBuf.get() + offset, numSamples, rates.get() + offset );
+        offset += numSamples;
+    }
+
+    // The golden standard accumulates phase in extended precision.
+    long double theta = phi;
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        const auto ideal = std::polar( 1.0L, theta );
+        auto expected = FlyingPhasorElementType{ double( ideal.real() ), double( ideal.imag() ) };
+        if ( accumulate ) expected += prior;
+        if ( std::abs( expected - testBuf[ i ] ) > 1e-12 )
+        {
+            std::cout << "Frequency modulation (accumulate " << accumulate << ") differs at sample " << i
+                      << " by " << std::abs( expected - testBuf[ i ] ) << std::endl;
+            return failCode;
+        }
+        theta += rates[ i ];
+    }
+
+    // Afterward, the instance carries on, phase continuous, at the last rate.
+    if ( NUM_SAMPLES != testGen.getSampleCount() )
+    {
+        std::cout << "Frequency modulation sample count is " << testGen.getSampleCount() << std::endl;
+        return failCode + 1;
+    }
+    for ( size_t i = 0; 10 != i; ++i )
+    {
+        const auto ideal = std::polar( 1.0L, theta );
+        if ( std::abs( FlyingPhasorElementType{ double( ideal.real() ), double( ideal.imag() ) } - testGen.getSample() ) > 1e-12 )
+        {
+            std::cout << "Frequency modulation (accumulate " << accumulate << ") did not carry on at the last rate"
+                      << std::endl;
+            return failCode + 2;
+        }
+        theta += rates[ NUM_SAMPLES - 1 ];
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runPhaseModulationTest( false, 1 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runPhaseModulationTest( true, 3 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runFrequencyModulationTest( false, 0.05, 11 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runFrequencyModulationTest( true, 0.05, 21 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runFrequencyModulationTest( false, 1e-4, 31 );
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file testMultiChannel.cpp
+ * @brief Test Multi-Channel Generator Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorMultiChannelGenerator.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // More than one group of channels and, not a multiple of a group.
+    constexpr size_t NUM_CHANNELS = 300;
+
+    // A mixture of request sizes, some serviced by the vectorized recurrence and some by the multi-lane kernels.
+    const size_t requestSizes[] = { 10, 1000, 33, 250, 64, 1, 129, 7 };
+    constexpr size_t MAX_REQUEST = 1000;
+
+    double channelRate( size_t c ) { return -3.0 + 6.0 * double( c ) / NUM_CHANNELS; }
+    double channelPhi( size_t c ) { return 0.01 * double( c ); }
+}
+
+int runVersusToneGeneratorTest( bool channelMajor, bool accumulate, int failCode )
+{
+    std::vector< double > rates( NUM_CHANNELS );
+    std::vector< double > phis( NUM_CHANNELS );
+    std::vector< FlyingPhasorToneGenerator > goldenGens{};
+    for ( size_t c = 0; NUM_CHANNELS != c; ++c )
+    {
+        rates[ c ] = channelRate( c );
+        phis[ c ] = channelPhi( c );
+        goldenGens.emplace_back( rates[ c ], phis[ c ] );
+    }
+    FlyingPhasorMultiChannelGenerator testGen{ NUM_CHANNELS, rates.data(), phis.data() };
+
+    std::unique_ptr< FlyingPhasorElementType[] > goldenBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorElementType[] > testBuf{new FlyingPhasorElementType[NUM_CHANNELS * MAX_REQUEST] };
+    std::vector< FlyingPhasorElementBufferTypePtr > testPtrs( NUM_CHANNELS );
+
+    int requestNum = 0;
+    for ( auto numSamples : requestSizes )
+    {
+        // Reset some channels part way through. That must match what the tone generator does.
+        if ( 3 == requestNum )
+        {
+            for ( size_t c = 5; NUM_CHANNELS > c; c += 7 )
+            {
+                goldenGens[ c ].reset( -rates[ c ] / 2.0, 1.25 );
+                testGen.resetChannel( c, -rates[ c ] / 2.0, 1.25 );
+            }
+        }
+        ++requestNum;
+
+        // Channel major or, per channel buffers laid out back to front. Accumulate onto something that is not zero.
+        for ( size_t c = 0; NUM_CHANNELS != c; ++c )
+            testPtrs[ c ] = testBuf.get() + ( channelMajor ? c : NUM_CHANNELS - 1 - c ) * numSamples;
+        for ( size_t i = 0; NUM_CHANNELS * numSamples != i; ++i )
+            testBuf[ i ] = FlyingPhasorElementType{ 0.5, -0.25 * double( i % 13 ) };
+
+        if ( channelMajor )
+            accumulate ? testGen.accumSamples( testBuf.get(), numSamples ) : testGen.getSamples( testBuf.get(), numSamples );
+        else
+            accumulate ? testGen.accumSamples( testPtrs.data(), numSamples ) : testGen.getSamples( testPtrs.data(), numSamples );
+
+        for ( size_t c = 0; NUM_CHANNELS != c; ++c )
+        {
+            const size_t base = size_t( testPtrs[ c ] - testBuf.get() );
+            for ( size_t i = 0; numSamples != i; ++i )
+                goldenBuf[ i ] = FlyingPhasorElementType{ 0.5, -0.25 * double( ( base + i ) % 13 ) };
+            accumulate ? goldenGens[ c ].accumSamples( goldenBuf.get(), numSamples ) :
+                         goldenGens[ c ].getSamples( goldenBuf.get(), numSamples );
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                if ( goldenBuf[ i ] != testPtrs[ c ][ i ] )
+                {
+                    std::cout << "Channel " << c << " (channel major " << channelMajor << ", accumulate " << accumulate
+                              << ") differs for request size " << numSamples << " at index " << i << ". Multi-channel: "
+                              << testPtrs[ c ][ i ] << ", tone generator: " << goldenBuf[ i ] << std::endl;
+                    return failCode;
+                }
+            }
+
+            if ( goldenGens[ c ].peekNextSample() != testGen.peekNextSample( c ) ||
+                 goldenGens[ c ].getSampleCount() != testGen.getSampleCount( c ) )
+            {
+                std::cout << "Channel " << c << " state differs for request size " << numSamples << std::endl;
+                return failCode + 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int runRetuneTest()
+{
+    const double rates[] = { 0.3, -1.2 };
+    FlyingPhasorMultiChannelGenerator testGen{ 2, rates };
+    FlyingPhasorElementType buf[ 2 * 20 ];
+    testGen.getSamples( buf, 20 );
+
+    // The first sample after a retune is the one that was due and, the next is advanced by the new rate.
+    const auto due = testGen.peekNextSample( 1 );
+    testGen.retuneChannel( 1, 2.5 );
+    testGen.getSamples( buf, 20 );
+    if ( due != buf[ 20 ] || std::abs( due * std::polar( 1.0, 2.5 ) - buf[ 21 ] ) > 1e-15 )
+    {
+        std::cout << "Retune was not phase continuous. Got " << buf[ 20 ] << ", " << buf[ 21 ] << std::endl;
+        return 11;
+    }
+
+    // The other channel must carry on undisturbed.
+    FlyingPhasorToneGenerator goldenGen{ rates[ 0 ] };
+    FlyingPhasorElementType goldenBuf[ 40 ];
+    goldenGen.getSamples( goldenBuf, 40 );
+    for ( size_t i = 0; 20 != i; ++i )
+    {
+        if ( goldenBuf[ 20 + i ] != buf[ i ] )
+        {
+            std::cout << "Retune disturbed another channel at index " << i << std::endl;
+            return 12;
+        }
+    }
+
+    return 0;
+}
+
+int runInvalidArgumentTest()
+{
+    try
+    {
+        FlyingPhasorMultiChannelGenerator gen{ 4, nullptr };
+        std::cout << "Missing rates were accepted" << std::endl;
+        return 21;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    const double rate = 0.5;
+    FlyingPhasorMultiChannelGenerator gen{ 1, &rate };
+    if ( 1 != gen.getChannelCount() )
+    {
+        std::cout << "Channel count is " << gen.getChannelCount() << std::endl;
+        return 22;
+    }
+    try
+    {
+        gen.retuneChannel( 1, rate );
+        std::cout << "Out of range channel was accepted" << std::endl;
+        return 23;
+    }
+    catch ( const std::invalid_argument & ) {}
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runVersusToneGeneratorTest( true, false, 1 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runVersusToneGeneratorTest( true, true, 3 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runVersusToneGeneratorTest( false, false, 5 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runVersusToneGeneratorTest( false, true, 7 );
+        if ( 0 != retCode )
+            break;
+
+        retCode = runRetuneTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
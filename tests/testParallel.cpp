@@ -0,0 +1,136 @@
+/**
+ * @file testParallel.cpp
+ * @brief Test Parallel Generation Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Large enough for several segments and, not a multiple of any thread count we try.
+    constexpr size_t NUM_SAMPLES = ( size_t( 1 ) << 20 ) + 13;
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    // Segments are seeded by jumping the phasor ahead rather than rotating up to it, which may
+    // differ from a serial run by a few ULPs of accumulated rounding.
+    constexpr double maxDiff = 1e-12;
+}
+
+int runParallelVersusSerialTest( unsigned int numThreads )
+{
+    std::unique_ptr< FlyingPhasorElementType[] > serialElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > parallelElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    FlyingPhasorToneGenerator serialGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator parallelGen{ radiansPerSample, phi };
+
+    serialGen.getSamples( serialElementBuf.get(), NUM_SAMPLES );
+    parallelGen.getSamplesParallel( parallelElementBuf.get(), NUM_SAMPLES, numThreads );
+
+    // Every sample, including either side of every segment boundary, must agree with the serial run
+    // and, the phase must advance by the rate from each sample to the next.
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        if ( std::abs( serialElementBuf[ i ] - parallelElementBuf[ i ] ) > maxDiff )
+        {
+            std::cout << "Threads: " << numThreads << ", sample " << i << " differs from serial by "
+                      << std::abs( serialElementBuf[ i ] - parallelElementBuf[ i ] ) << std::endl;
+            return 1;
+        }
+        if ( 0 != i )
+        {
+            const double delta = deltaAngle( std::arg( parallelElementBuf[ i - 1 ] ), std::arg( parallelElementBuf[ i ] ) );
+            if ( std::fabs( deltaAngle( delta, radiansPerSample ) ) > maxDiff )
+            {
+                std::cout << "Threads: " << numThreads << ", phase discontinuity at sample " << i << ": "
+                          << delta << std::endl;
+                return 2;
+            }
+        }
+    }
+
+    // The generator must pick up right where the serial one would.
+    if ( serialGen.getSampleCount() != parallelGen.getSampleCount() )
+    {
+        std::cout << "Threads: " << numThreads << ", sample count " << parallelGen.getSampleCount()
+                  << ", expected " << serialGen.getSampleCount() << std::endl;
+        return 3;
+    }
+    if ( std::abs( serialGen.peekNextSample() - parallelGen.peekNextSample() ) > maxDiff )
+    {
+        std::cout << "Threads: " << numThreads << ", next sample differs from serial" << std::endl;
+        return 4;
+    }
+    if ( std::abs( serialGen.getSample() - parallelGen.getSample() ) > maxDiff )
+    {
+        std::cout << "Threads: " << numThreads << ", subsequent sample differs from serial" << std::endl;
+        return 5;
+    }
+
+    return 0;
+}
+
+int runSmallRequestTest()
+{
+    // A request too small to split is simply generated by the invoking thread and, must be identical to serial.
+    constexpr size_t numSamples = 1000;
+    std::unique_ptr< FlyingPhasorElementType[] > serialElementBuf{new FlyingPhasorElementType[numSamples] };
+    std::unique_ptr< FlyingPhasorElementType[] > parallelElementBuf{new FlyingPhasorElementType[numSamples] };
+
+    FlyingPhasorToneGenerator serialGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator parallelGen{ radiansPerSample, phi };
+
+    serialGen.getSamples( serialElementBuf.get(), numSamples );
+    parallelGen.getSamplesParallel( parallelElementBuf.get(), numSamples, 8 );
+    for ( size_t i = 0; numSamples != i; ++i )
+    {
+        if ( serialElementBuf[ i ] != parallelElementBuf[ i ] )
+        {
+            std::cout << "Small request sample " << i << " differs from serial" << std::endl;
+            return 11;
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        // Zero selects the hardware concurrency.
+        for ( unsigned int numThreads : { 1U, 2U, 3U, 4U, 7U, 0U } )
+        {
+            retCode = runParallelVersusSerialTest( numThreads );
+            if ( 0 != retCode )
+                break;
+        }
+        if ( 0 != retCode )
+            break;
+
+        retCode = runSmallRequestTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
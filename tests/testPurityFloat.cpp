@@ -0,0 +1,176 @@
+/**
+ * @file testPurityFloat.cpp
+ * @brief Tests Single Precision Phase and Magnitude Purity With User Specified Parameters
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGeneratorFloat.h"
+
+#include "CommandLineParser.h"
+#include "MiscTestUtilities.h"
+#include "StatsStateMachine.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+// Runs phase and magnitude statistics over a single precision series. The analysis itself is
+// carried out in double precision so that it contributes nothing measurable of its own.
+struct PurityStats
+{
+    std::pair< double, double > phaseStats;
+    double phasePeakAbsDev;
+    std::pair< double, double > magStats;
+    double magPeakAbsDev;
+};
+
+PurityStats analyze( const FlyingPhasorFloatElementType * pBuf, size_t nSamples, double radiansPerSample )
+{
+    StatsStateMachine phaseStatsStateMachine{};
+    StatsStateMachine magStatsStateMachine{};
+    for ( size_t n=0; nSamples != n; ++n )
+    {
+        // We cheat the first sample because there is no previous one in order to compute
+        // a delta. Being that we are expecting a periodic complex waveform, this would be
+        // the radiansPerSample given as an argument.
+        const std::complex< double > sample{ pBuf[ n ] };
+        auto phaseDelta = 0 == n ? radiansPerSample :
+                deltaAngle( std::arg( std::complex< double >{ pBuf[ n - 1 ] } ), std::arg( sample ) );
+        phaseStatsStateMachine.addSample( phaseDelta );
+        magStatsStateMachine.addSample( std::abs( sample ) );
+    }
+
+    PurityStats stats{};
+    stats.phaseStats = phaseStatsStateMachine.getStats();
+    auto phaseMinMaxDev = phaseStatsStateMachine.getMinMaxDev();
+    stats.phasePeakAbsDev = std::max( -phaseMinMaxDev.first, phaseMinMaxDev.second );
+    stats.magStats = magStatsStateMachine.getStats();
+    auto magMinMaxDev = magStatsStateMachine.getMinMaxDev();
+    stats.magPeakAbsDev = std::max( -magMinMaxDev.first, magMinMaxDev.second );
+    return stats;
+}
+
+void report( const PurityStats & stats )
+{
+    double signalPower = stats.magStats.first * stats.magStats.first / 2;   // Should always be 0.5
+    std::cout << "Mean Angular Rate: " << stats.phaseStats.first << ", Variance: " << stats.phaseStats.second
+              << ", maxAbsDev: " << stats.phasePeakAbsDev << std::endl;
+    std::cout << "Mean Magnitude: " << stats.magStats.first << ", Variance: " << stats.magStats.second
+              << ", SNR: " << 10.0 * std::log10( signalPower / stats.magStats.second ) << " dB"
+              << ", maxAbsDev: " << stats.magPeakAbsDev << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    // Parse potential command line. Defaults provided otherwise.
+    CommandLineParser cmdLineParser{};
+    if ( 0 != cmdLineParser.parseCommandLine(argc, argv) )
+    {
+        std::cout << "Failed parsing command line" << std::endl;
+        std::cout << "Optional Arguments are:" << std::endl;
+        std::cout << "\t--radsPerSample=<double>: The radians per sample to used." << std::endl;
+        std::cout << "\t--phase=<double>: The initial phase in radians." << std::endl;
+
+        exit( -1 );
+    }
+    else
+    {
+        std::cout << "Parsed: --radiansPerSample=" << cmdLineParser.getRadsPerSample()
+            << " --phase=" << cmdLineParser.getPhase() << std::endl << std::endl;
+    }
+    double radiansPerSample = cmdLineParser.getRadsPerSample();
+    double phi = cmdLineParser.getPhase();
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    // The single precision legacy series is std::exp in double precision rounded to float. That is,
+    // correctly rounded or very nearly so, as good as a float series can be. It is the baseline we
+    // hold the generator to. We exercise both the multi-lane kernels (one large request)
+    // and the serial loops (many small requests).
+    constexpr size_t numSamples = 4096;
+    constexpr size_t smallRequest = 16;
+    std::unique_ptr< FlyingPhasorFloatElementType[] > pLegacyToneSeries{new FlyingPhasorFloatElementType [ numSamples] };
+    std::unique_ptr< FlyingPhasorFloatElementType[] > pKernelToneSeries{new FlyingPhasorFloatElementType [ numSamples] };
+    std::unique_ptr< FlyingPhasorFloatElementType[] > pSerialToneSeries{new FlyingPhasorFloatElementType [ numSamples] };
+
+    constexpr std::complex< double > j{0.0, 1.0 };
+    for ( size_t n = 0; numSamples != n; ++n )
+        pLegacyToneSeries[ n ] = FlyingPhasorFloatElementType( std::exp( j * ( double( n ) * radiansPerSample + phi ) ) );
+
+    FlyingPhasorToneGeneratorFloat kernelGen{ radiansPerSample, phi };
+    kernelGen.getSamples( pKernelToneSeries.get(), numSamples );
+
+    FlyingPhasorToneGeneratorFloat serialGen{ radiansPerSample, phi };
+    for ( size_t n = 0; numSamples != n; n += smallRequest )
+        serialGen.getSamples( pSerialToneSeries.get() + n, smallRequest );
+
+    std::cout << "************ Legacy Single Precision Measurements ************" << std::endl;
+    auto legacyStats = analyze( pLegacyToneSeries.get(), numSamples, radiansPerSample );
+    report( legacyStats );
+    std::cout << std::endl;
+
+    std::cout << "************ Flying Phasor Single Precision Kernel Measurements ************" << std::endl;
+    auto kernelStats = analyze( pKernelToneSeries.get(), numSamples, radiansPerSample );
+    report( kernelStats );
+    std::cout << std::endl;
+
+    std::cout << "************ Flying Phasor Single Precision Serial Measurements ************" << std::endl;
+    auto serialStats = analyze( pSerialToneSeries.get(), numSamples, radiansPerSample );
+    report( serialStats );
+
+    // Now for the Validating. The serial loops deliver double precision state rounded to float and, match
+    // the legacy series. The kernels derive samples in single precision arithmetic, at about 1.5 ULPs, which
+    // costs a few dB of SNR. The limits cover the kernels with headroom similar to that of testPurity.
+    int retCode = 0;
+    const PurityStats * pStats[] = { &kernelStats, &serialStats };
+    const char * names[] = { "Kernel", "Serial" };
+    for ( size_t i = 0; 2 != i && 0 == retCode; ++i )
+    {
+        const auto & stats = *pStats[ i ];
+        if ( !inTolerance( stats.phaseStats.first, radiansPerSample, 1e-8 ) )
+        {
+            std::cout << names[ i ] << " FAILS Mean Angular Rate Test! Expected: " << radiansPerSample
+                      << ", Detected: " << stats.phaseStats.first << std::endl;
+            retCode = 1;
+        }
+        else if ( stats.phaseStats.second > 1.5e-15 )
+        {
+            std::cout << names[ i ] << " FAILS Angular Rate Variance Test! Expected: less than " << 1.5e-15
+                      << ", Detected: " << stats.phaseStats.second << std::endl;
+            retCode = 2;
+        }
+        else if ( stats.phasePeakAbsDev > 2e-7 )
+        {
+            std::cout << names[ i ] << " FAILS Angular Rate Peak Absolute Deviation! Expected less than: " << 2e-7
+                      << ", Detected: " << stats.phasePeakAbsDev << std::endl;
+            retCode = 3;
+        }
+        else if ( !inTolerance( stats.magStats.first, 1.0, 1e-8 ) )
+        {
+            std::cout << names[ i ] << " FAILS Mean Magnitude Test! Expected: " << 1.0
+                      << ", Detected: " << stats.magStats.first << std::endl;
+            retCode = 4;
+        }
+        else if ( stats.magStats.second > 1.5e-15 )
+        {
+            std::cout << names[ i ] << " FAILS Magnitude Variance Test! Expected: less than " << 1.5e-15
+                      << ", Detected: " << stats.magStats.second << std::endl;
+            retCode = 5;
+        }
+        else if ( stats.magPeakAbsDev > 1.5e-7 )
+        {
+            std::cout << names[ i ] << " FAILS Magnitude Peak Absolute Deviation! Expected less than: " << 1.5e-7
+                      << ", Detected: " << stats.magPeakAbsDev << std::endl;
+            retCode = 6;
+        }
+    }
+
+    exit( retCode );
+    return retCode;
+}
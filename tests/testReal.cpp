@@ -0,0 +1,161 @@
+/**
+ * @file testReal.cpp
+ * @brief Test Real Only Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = -1.1;
+    constexpr double phi = 0.4;
+
+    // A mixture of request sizes, some serviced by the serial loops and some by the multi-lane kernels.
+    const size_t requestSizes[] = { 10, 1000, 33, 2500, 64, 1, 4097 };
+    constexpr size_t MAX_REQUEST = 4097;
+    constexpr size_t TOTAL_SAMPLES = 10 + 1000 + 33 + 2500 + 64 + 1 + 4097;
+
+    enum class Op { Get, GetScaled, GetEnveloped, Accum, AccumScaled, AccumEnveloped };
+    const char * opNames[] = { "Get", "GetScaled", "GetEnveloped", "Accum", "AccumScaled", "AccumEnveloped" };
+
+    constexpr double scalar = 3.25;
+
+    void split( FlyingPhasorToneGenerator & gen, Op op, double * pRe, double * pIm,
+                size_t numSamples, const double * pScalars )
+    {
+        switch ( op )
+        {
+            case Op::Get: gen.getSamplesSplit( pRe, pIm, numSamples ); break;
+            case Op::GetScaled: gen.getSamplesScaledSplit( pRe, pIm, numSamples, scalar ); break;
+            case Op::GetEnveloped: gen.getSamplesScaledSplit( pRe, pIm, numSamples, pScalars ); break;
+            case Op::Accum: gen.accumSamplesSplit( pRe, pIm, numSamples ); break;
+            case Op::AccumScaled: gen.accumSamplesScaledSplit( pRe, pIm, numSamples, scalar ); break;
+            case Op::AccumEnveloped: gen.accumSamplesScaledSplit( pRe, pIm, numSamples, pScalars ); break;
+        }
+    }
+
+    void real( FlyingPhasorToneGenerator & gen, Op op, double * pRe, size_t numSamples, const double * pScalars )
+    {
+        switch ( op )
+        {
+            case Op::Get: gen.getSamplesReal( pRe, numSamples ); break;
+            case Op::GetScaled: gen.getSamplesScaledReal( pRe, numSamples, scalar ); break;
+            case Op::GetEnveloped: gen.getSamplesScaledReal( pRe, numSamples, pScalars ); break;
+            case Op::Accum: gen.accumSamplesReal( pRe, numSamples ); break;
+            case Op::AccumScaled: gen.accumSamplesScaledReal( pRe, numSamples, scalar ); break;
+            case Op::AccumEnveloped: gen.accumSamplesScaledReal( pRe, numSamples, pScalars ); break;
+        }
+    }
+}
+
+int runRealVersusSplitTest()
+{
+    std::unique_ptr< double[] > goldenRealBuf{new double[MAX_REQUEST] };
+    std::unique_ptr< double[] > goldenImagBuf{new double[MAX_REQUEST] };
+    std::unique_ptr< double[] > testRealBuf{new double[MAX_REQUEST] };
+    std::unique_ptr< double[] > scalarsBuf{new double[MAX_REQUEST] };
+    for ( size_t i = 0; MAX_REQUEST != i; ++i )
+        scalarsBuf[ i ] = 1.0 + 0.001 * double( i );
+
+    // Every operation, for every request size, must deliver bit for bit the real plane its split counterpart does.
+    for ( int o = 0; 6 != o; ++o )
+    {
+        const auto op = Op( o );
+        FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+        FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+        for ( auto numSamples : requestSizes )
+        {
+            // Accumulate onto something that is not zero.
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                goldenRealBuf[ i ] = testRealBuf[ i ] = 0.5 * double( i );
+                goldenImagBuf[ i ] = -1.0;
+            }
+
+            split( goldenGen, op, goldenRealBuf.get(), goldenImagBuf.get(), numSamples, scalarsBuf.get() );
+            real( testGen, op, testRealBuf.get(), numSamples, scalarsBuf.get() );
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                if ( goldenRealBuf[ i ] != testRealBuf[ i ] )
+                {
+                    std::cout << "Failed " << opNames[ o ] << " real test for request size " << numSamples
+                              << " at index " << i << ". Real: " << testRealBuf[ i ] << ", split: "
+                              << goldenRealBuf[ i ] << std::endl;
+                    return 1 + o;
+                }
+            }
+
+            if ( goldenGen.peekNextSample() != testGen.peekNextSample() ||
+                 goldenGen.getSampleCount() != testGen.getSampleCount() )
+            {
+                std::cout << "Failed " << opNames[ o ] << " real state test for request size " << numSamples << std::endl;
+                return 11 + o;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int runRealPurityTest()
+{
+    std::unique_ptr< double[] > testRealBuf{new double[TOTAL_SAMPLES] };
+
+    // Phase must carry across requests of assorted sizes.
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    size_t offset = 0;
+    for ( auto numSamples : requestSizes )
+    {
+        testGen.getSamplesReal( testRealBuf.get() + offset, numSamples );
+        offset += numSamples;
+    }
+
+    // The golden standard is std::cos of the phase, in extended precision.
+    for ( size_t i = 0; TOTAL_SAMPLES != i; ++i )
+    {
+        const long double expected = std::cos( (long double)phi + (long double)radiansPerSample * i );
+        if ( std::fabs( double( expected ) - testRealBuf[ i ] ) > 1e-12 )
+        {
+            std::cout << "Failed real purity test at sample " << i << ". Real: " << testRealBuf[ i ]
+                      << ", cos: " << double( expected ) << std::endl;
+            return 21;
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        retCode = runRealVersusSplitTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runRealPurityTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file testSeek.cpp
+ * @brief Test Skip Samples and Seek Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <limits>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 2.0;
+    constexpr double phi = -1.5;
+    constexpr size_t NUM_SAMPLES = 2000;
+
+    double maxDifference( const FlyingPhasorElementType * pA, const FlyingPhasorElementType * pB, size_t numSamples )
+    {
+        double maxDiff = 0.0;
+        for ( size_t i = 0; numSamples != i; ++i )
+            maxDiff = std::max( maxDiff, std::abs( pA[ i ] - pB[ i ] ) );
+        return maxDiff;
+    }
+}
+
+int runSkipVersusGenerateTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > scratchBuf{new FlyingPhasorElementType[1000000] };
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    // Skipping must land where generating and discarding does, odd and even, large and small.
+    const size_t skips[] = { 1, 63, 1000, 1000000, 7 };
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    for ( auto numSkip : skips )
+    {
+        goldenGen.getSamples( scratchBuf.get(), numSkip );
+        testGen.skipSamples( numSkip );
+        if ( goldenGen.getSampleCount() != testGen.getSampleCount() )
+        {
+            std::cout << "Sample count after skipping " << numSkip << " should be " << goldenGen.getSampleCount()
+                      << " and is " << testGen.getSampleCount() << std::endl;
+            return 1;
+        }
+
+        // The two take different paths and so, may differ by the odd ULP, plus whatever the generator
+        // itself accumulated over the samples skipped.
+        goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+        testGen.getSamples( testElementBuf.get(), NUM_SAMPLES );
+        const auto maxDiff = maxDifference( goldenElementBuf.get(), testElementBuf.get(), NUM_SAMPLES );
+        if ( maxDiff > 1e-12 )
+        {
+            std::cout << "Samples after skipping " << numSkip << " differ by " << maxDiff << std::endl;
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+int runSeekTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    // Seek forward a long way, then back to the start and compare with a fresh instance.
+    FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+    testGen.seek( 123456789 );
+    testGen.getSamples( testElementBuf.get(), NUM_SAMPLES );
+    testGen.seek( 0 );
+    if ( 0 != testGen.getSampleCount() )
+    {
+        std::cout << "Sample count after seeking to zero is " << testGen.getSampleCount() << std::endl;
+        return 11;
+    }
+    goldenGen.getSamples( goldenElementBuf.get(), NUM_SAMPLES );
+    testGen.getSamples( testElementBuf.get(), NUM_SAMPLES );
+    auto maxDiff = maxDifference( goldenElementBuf.get(), testElementBuf.get(), NUM_SAMPLES );
+    if ( maxDiff > 1e-12 )
+    {
+        std::cout << "Samples after seeking back to zero differ by " << maxDiff << std::endl;
+        return 12;
+    }
+
+    // Seeking to a billion samples in should land on the tone's closed form phase there. The closed form is
+    // only good to around 1e-10 radians where long double is wider than double and so, is only checked there.
+    constexpr size_t farIndex = 1000000000;
+    testGen.seek( farIndex );
+    if ( std::numeric_limits< long double >::digits > std::numeric_limits< double >::digits )
+    {
+        const auto rate = std::polar( 1.0, radiansPerSample );
+        const long double theta = std::atan2( (long double)rate.imag(), (long double)rate.real() );
+        const auto expected = std::polar( 1.0L, phi + theta * farIndex );
+        const auto diff = std::abs( testGen.peekNextSample() -
+                                    FlyingPhasorElementType{ double( expected.real() ), double( expected.imag() ) } );
+        if ( diff > 1e-9 )
+        {
+            std::cout << "Sample after seeking to " << farIndex << " differs from closed form by " << diff << std::endl;
+            return 13;
+        }
+    }
+
+    // From a fresh instance, seeking there in several jumps, back and forth, should land within the rounding
+    // of the phasor of seeking there directly.
+    FlyingPhasorToneGenerator directGen{ radiansPerSample, phi };
+    FlyingPhasorToneGenerator jumpsGen{ radiansPerSample, phi };
+    directGen.seek( farIndex );
+    jumpsGen.seek( 3 * farIndex );
+    jumpsGen.seek( farIndex / 2 );
+    jumpsGen.skipSamples( farIndex / 2 );
+    const auto jumpDiff = std::abs( directGen.peekNextSample() - jumpsGen.peekNextSample() );
+    if ( jumpDiff > 1e-15 )
+    {
+        std::cout << "Seeking to " << farIndex << " in jumps differs from seeking directly by " << jumpDiff << std::endl;
+        return 14;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        retCode = runSkipVersusGenerateTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runSeekTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file testSpectrumAnalyzer.cpp
+ * @brief Test Spectrum Analyzer Functionality
+ *
+ * The FFT must agree with a direct DFT, a spur of known level and frequency must be measured as such and,
+ * an ideal tone must measure as cleanly as rounding it to double precision allows, so that the analyzer
+ * itself is never what limits a measurement.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "SpectrumAnalyzer.h"
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr long double twoPi = 6.283185307179586476925286766559005768L;
+
+    constexpr size_t FFT_SIZE = 4096;
+    constexpr size_t TONE_BIN = 100;
+    constexpr size_t SPUR_BIN = FFT_SIZE - 1000;     // A negative frequency.
+    constexpr double spurAmplitude = 1e-6;           // -120 dBc.
+
+    // A tone of some number of cycles per block, formed in extended precision and rounded once.
+    FlyingPhasorElementType idealSample( double cyclesPerBlock, size_t n, size_t fftSize )
+    {
+        const auto s = std::polar( 1.0L, twoPi * cyclesPerBlock * (long double)n / (long double)fftSize );
+        return FlyingPhasorElementType{ double( s.real() ), double( s.imag() ) };
+    }
+}
+
+int runTransformTest()
+{
+    // Compare the power spectrum of an arbitrary waveform with that of a direct DFT.
+    constexpr size_t N = 64;
+    FlyingPhasorElementType samples[ N ];
+    for ( size_t n = 0; N != n; ++n )
+        samples[ n ] = FlyingPhasorElementType{ std::cos( 0.7 * double( n * n ) ), std::sin( 1.3 * double( n ) ) };
+
+    SpectrumAnalyzer analyzer{ N };
+    analyzer.addSamples( samples );
+    const auto spectrum = analyzer.getPowerSpectrumDb();
+    for ( size_t k = 0; N != k; ++k )
+    {
+        std::complex< long double > sum{};
+        for ( size_t n = 0; N != n; ++n )
+            sum += std::complex< long double >{ samples[ n ].real(), samples[ n ].imag() } *
+                   std::polar( 1.0L, -twoPi * (long double)( k * n % N ) / (long double)N );
+        const double expected = 10.0 * std::log10( double( std::norm( sum ) ) / double( N * N ) );
+        if ( 1e-9 < std::fabs( expected - spectrum[ k ] ) )
+        {
+            std::cout << "Bin " << k << " is " << spectrum[ k ] << " dB, expected " << expected << " dB" << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int runKnownSpurTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > buf{new FlyingPhasorElementType[FFT_SIZE] };
+    for ( size_t n = 0; FFT_SIZE != n; ++n )
+        buf[ n ] = idealSample( TONE_BIN, n, FFT_SIZE ) + spurAmplitude * idealSample( SPUR_BIN, n, FFT_SIZE );
+
+    // Averaged over several identical blocks, nothing changes.
+    SpectrumAnalyzer analyzer{ FFT_SIZE };
+    for ( int a = 0; 3 != a; ++a )
+        analyzer.addSamples( buf.get() );
+    const auto results = analyzer.analyze();
+    std::cout << "Known spur measured at " << results.spurPowerDbc << " dBc in bin " << results.spurBin << std::endl;
+
+    if ( TONE_BIN != results.peakBin || 1e-9 < std::fabs( results.peakPowerDb ) || 3 != analyzer.getNumAverages() )
+        return 11;
+    if ( SPUR_BIN != results.spurBin || 1e-6 < std::fabs( results.sfdrDb - 120.0 ) )
+        return 12;
+    if ( -1000.0 / double( FFT_SIZE ) != analyzer.binToFraction( results.spurBin ) )
+        return 13;
+
+    return 0;
+}
+
+int runIdealToneTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > buf{new FlyingPhasorElementType[FFT_SIZE] };
+    for ( size_t n = 0; FFT_SIZE != n; ++n )
+        buf[ n ] = idealSample( TONE_BIN, n, FFT_SIZE );
+
+    SpectrumAnalyzer analyzer{ FFT_SIZE };
+    analyzer.addSamples( buf.get() );
+    const auto results = analyzer.analyze();
+    std::cout << "Ideal tone SFDR: " << results.sfdrDb << " dB, noise floor: " << results.noiseFloorDbc
+              << " dBc" << std::endl;
+
+    // Rounding to double precision alone limits an ideal tone to around 320 dB of SFDR. The flying phasor's
+    // kernels measure around 300 dB. The analyzer must not be what limits either.
+    if ( 310.0 > results.sfdrDb || -360.0 < results.noiseFloorDbc )
+        return 21;
+
+    // Between bins, the Blackman-Harris window loses no more than its scalloping loss and, its side lobes
+    // are at -92 dB.
+    for ( size_t n = 0; FFT_SIZE != n; ++n )
+        buf[ n ] = idealSample( TONE_BIN + 0.5, n, FFT_SIZE );
+    SpectrumAnalyzer windowedAnalyzer{ FFT_SIZE, SpectrumAnalyzer::Window::BlackmanHarris };
+    windowedAnalyzer.addSamples( buf.get() );
+    const auto windowedResults = windowedAnalyzer.analyze();
+    std::cout << "Windowed tone between bins: " << windowedResults.peakPowerDb << " dB, SFDR: "
+              << windowedResults.sfdrDb << " dB" << std::endl;
+    if ( -1.0 > windowedResults.peakPowerDb || 90.0 > windowedResults.sfdrDb )
+        return 22;
+
+    return 0;
+}
+
+int runInvalidArgumentTest()
+{
+    for ( size_t fftSize : { size_t( 0 ), size_t( 8 ), size_t( 1000 ) } )
+    {
+        try
+        {
+            SpectrumAnalyzer analyzer{ fftSize };
+            std::cout << "An FFT size of " << fftSize << " was accepted" << std::endl;
+            return 31;
+        }
+        catch ( const std::invalid_argument & ) {}
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runTransformTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runKnownSpurTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runIdealToneTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runInvalidArgumentTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file testSplit.cpp
+ * @brief Test Split Plane Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = -1.1;
+    constexpr double phi = 0.4;
+
+    // A mixture of request sizes, some serviced by the serial loops and some by the multi-lane kernels.
+    const size_t requestSizes[] = { 10, 1000, 33, 2500, 64, 1, 4097 };
+    constexpr size_t MAX_REQUEST = 4097;
+
+    enum class Op { Get, GetScaled, GetEnveloped, Accum, AccumScaled, AccumEnveloped };
+    const char * opNames[] = { "Get", "GetScaled", "GetEnveloped", "Accum", "AccumScaled", "AccumEnveloped" };
+
+    constexpr double scalar = 3.25;
+
+    void interleaved( FlyingPhasorToneGenerator & gen, Op op, FlyingPhasorElementBufferTypePtr pBuf,
+                      size_t numSamples, const double * pScalars )
+    {
+        switch ( op )
+        {
+            case Op::Get: gen.getSamples( pBuf, numSamples ); break;
+            case Op::GetScaled: gen.getSamplesScaled( pBuf, numSamples, scalar ); break;
+            case Op::GetEnveloped: gen.getSamplesScaled( pBuf, numSamples, pScalars ); break;
+            case Op::Accum: gen.accumSamples( pBuf, numSamples ); break;
+            case Op::AccumScaled: gen.accumSamplesScaled( pBuf, numSamples, scalar ); break;
+            case Op::AccumEnveloped: gen.accumSamplesScaled( pBuf, numSamples, pScalars ); break;
+        }
+    }
+
+    void split( FlyingPhasorToneGenerator & gen, Op op, double * pRe, double * pIm,
+                size_t numSamples, const double * pScalars )
+    {
+        switch ( op )
+        {
+            case Op::Get: gen.getSamplesSplit( pRe, pIm, numSamples ); break;
+            case Op::GetScaled: gen.getSamplesScaledSplit( pRe, pIm, numSamples, scalar ); break;
+            case Op::GetEnveloped: gen.getSamplesScaledSplit( pRe, pIm, numSamples, pScalars ); break;
+            case Op::Accum: gen.accumSamplesSplit( pRe, pIm, numSamples ); break;
+            case Op::AccumScaled: gen.accumSamplesScaledSplit( pRe, pIm, numSamples, scalar ); break;
+            case Op::AccumEnveloped: gen.accumSamplesScaledSplit( pRe, pIm, numSamples, pScalars ); break;
+        }
+    }
+}
+
+int runSplitVersusInterleavedTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< double[] > testRealBuf{new double[MAX_REQUEST] };
+    std::unique_ptr< double[] > testImagBuf{new double[MAX_REQUEST] };
+    std::unique_ptr< double[] > scalarsBuf{new double[MAX_REQUEST] };
+    for ( size_t i = 0; MAX_REQUEST != i; ++i )
+        scalarsBuf[ i ] = 1.0 + 0.001 * double( i );
+
+    // Every operation, for every request size, must deliver bit for bit what its interleaved counterpart does.
+    for ( int o = 0; 6 != o; ++o )
+    {
+        const auto op = Op( o );
+        FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+        FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+        for ( auto numSamples : requestSizes )
+        {
+            // Accumulate onto something that is not zero.
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                goldenElementBuf[ i ] = FlyingPhasorElementType{ 0.5 * double( i ), -1.0 };
+                testRealBuf[ i ] = 0.5 * double( i );
+                testImagBuf[ i ] = -1.0;
+            }
+
+            interleaved( goldenGen, op, goldenElementBuf.get(), numSamples, scalarsBuf.get() );
+            split( testGen, op, testRealBuf.get(), testImagBuf.get(), numSamples, scalarsBuf.get() );
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                if ( goldenElementBuf[ i ].real() != testRealBuf[ i ] || goldenElementBuf[ i ].imag() != testImagBuf[ i ] )
+                {
+                    std::cout << "Failed " << opNames[ o ] << " split test for request size " << numSamples
+                              << " at index " << i << ". Split: (" << testRealBuf[ i ] << "," << testImagBuf[ i ]
+                              << "), interleaved: " << goldenElementBuf[ i ] << std::endl;
+                    return 1 + o;
+                }
+            }
+
+            if ( goldenGen.peekNextSample() != testGen.peekNextSample() ||
+                 goldenGen.getSampleCount() != testGen.getSampleCount() )
+            {
+                std::cout << "Failed " << opNames[ o ] << " split state test for request size " << numSamples << std::endl;
+                return 11 + o;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        retCode = runSplitVersusInterleavedTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
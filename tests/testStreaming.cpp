@@ -0,0 +1,91 @@
+/**
+ * @file testStreaming.cpp
+ * @brief Test Streaming Store Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cstdint>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double radiansPerSample = 0.3;
+    constexpr double phi = 0.7;
+
+    // A mixture of request sizes, some deferred to getSamples and some streamed, with and without partial
+    // blocks, chunks and cache lines.
+    const size_t requestSizes[] = { 10, 1000, 33, 4097, 128, 1, 100003, 512 };
+    constexpr size_t MAX_REQUEST = 100003;
+
+    // Sample offsets from a cache line boundary. Every possible head, for whole samples.
+    constexpr size_t NUM_OFFSETS = 4;
+}
+
+int runStreamingVersusGetSamplesTest()
+{
+    // Room to find a cache line boundary and, offset from it.
+    std::unique_ptr< FlyingPhasorElementType[] > goldenBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorElementType[] > testStorage{new FlyingPhasorElementType[MAX_REQUEST + 8] };
+    const auto misalignment = reinterpret_cast< std::uintptr_t >( testStorage.get() ) % 64;
+    const auto pAligned = testStorage.get() + ( 0 == misalignment ? 0 : ( 64 - misalignment ) / 16 );
+
+    for ( size_t offset = 0; NUM_OFFSETS != offset; ++offset )
+    {
+        const auto pTestBuf = pAligned + offset;
+        FlyingPhasorToneGenerator goldenGen{ radiansPerSample, phi };
+        FlyingPhasorToneGenerator testGen{ radiansPerSample, phi };
+
+        for ( auto numSamples : requestSizes )
+        {
+            goldenGen.getSamples( goldenBuf.get(), numSamples );
+            testGen.getSamplesStreaming( pTestBuf, numSamples );
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                if ( goldenBuf[ i ] != pTestBuf[ i ] )
+                {
+                    std::cout << "Streaming differs for request size " << numSamples << " at offset " << offset
+                              << ", index " << i << ". Streaming: " << pTestBuf[ i ] << ", getSamples: "
+                              << goldenBuf[ i ] << std::endl;
+                    return 1;
+                }
+            }
+
+            if ( goldenGen.peekNextSample() != testGen.peekNextSample() ||
+                 goldenGen.getSampleCount() != testGen.getSampleCount() )
+            {
+                std::cout << "Streaming state differs for request size " << numSamples << " at offset " << offset
+                          << std::endl;
+                return 2;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    int retCode = 0;
+
+    do
+    {
+        retCode = runStreamingVersusGetSamplesTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
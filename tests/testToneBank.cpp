@@ -0,0 +1,336 @@
+/**
+ * @file testToneBank.cpp
+ * @brief Test Tone Bank Functionality
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 16, 2026
+ */
+
+#include "FlyingPhasorToneBank.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    struct ToneSpec
+    {
+        double radiansPerSample;
+        double phi;
+        double magnitude;
+    };
+
+    // Tones at various rates, phases and magnitudes, including DC and nyquist'ish.
+    const ToneSpec toneSpecs[] = {
+        { 0.1, 0.0, 1.0 },
+        { -0.75, 1.0, 0.5 },
+        { 2.0, -1.5, 0.25 },
+        { 0.0, 0.5, 2.0 },
+        { 3.1, 0.0, 1.5 }
+    };
+
+    // A mixture of request sizes, some serviced by the serial loops and some by the multi-lane kernels.
+    const size_t requestSizes[] = { 10, 1000, 33, 2500, 64, 1, 4097 };
+    constexpr size_t MAX_REQUEST = 4097;
+
+    // The per instance path. The first generator gets, the rest accumulate.
+    void perInstance( std::vector< FlyingPhasorToneGenerator > & gens, const std::vector< double > & mags,
+                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        for ( size_t t = 0; gens.size() != t; ++t )
+        {
+            if ( 0 == t && !accumulate )
+                gens[ t ].getSamplesScaled( pElementBuffer, numSamples, mags[ t ] );
+            else
+                gens[ t ].accumSamplesScaled( pElementBuffer, numSamples, mags[ t ] );
+        }
+    }
+
+    bool compare( const FlyingPhasorElementType * pA, const FlyingPhasorElementType * pB, size_t numSamples )
+    {
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( pA[ i ] != pB[ i ] )
+            {
+                std::cout << "Mismatch at index " << i << ", bank: " << pA[ i ] << ", per instance: " << pB[ i ] << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int runBankVersusPerInstanceTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+
+    FlyingPhasorToneBank bank{};
+    std::vector< FlyingPhasorToneBank::ToneId > toneIds{};
+    std::vector< FlyingPhasorToneGenerator > gens{};
+    std::vector< double > mags{};
+    for ( const auto & spec : toneSpecs )
+    {
+        toneIds.push_back( bank.addTone( spec.radiansPerSample, spec.phi, spec.magnitude ) );
+        gens.emplace_back( spec.radiansPerSample, spec.phi );
+        mags.push_back( spec.magnitude );
+    }
+
+    if ( gens.size() != bank.getToneCount() )
+    {
+        std::cout << "Tone count should be " << gens.size() << " and is " << bank.getToneCount() << std::endl;
+        return 1;
+    }
+
+    // Get samples.
+    for ( auto numSamples : requestSizes )
+    {
+        perInstance( gens, mags, goldenElementBuf.get(), numSamples, false );
+        bank.getSamples( testElementBuf.get(), numSamples );
+        if ( !compare( testElementBuf.get(), goldenElementBuf.get(), numSamples ) )
+        {
+            std::cout << "Failed getSamples test for request size " << numSamples << std::endl;
+            return 2;
+        }
+    }
+
+    // Accumulate samples onto something that is not zero.
+    for ( auto numSamples : requestSizes )
+    {
+        for ( size_t i = 0; numSamples != i; ++i )
+            goldenElementBuf[ i ] = testElementBuf[ i ] = FlyingPhasorElementType{ 0.5 * double( i ), -1.0 };
+
+        perInstance( gens, mags, goldenElementBuf.get(), numSamples, true );
+        bank.accumSamples( testElementBuf.get(), numSamples );
+        if ( !compare( testElementBuf.get(), goldenElementBuf.get(), numSamples ) )
+        {
+            std::cout << "Failed accumSamples test for request size " << numSamples << std::endl;
+            return 3;
+        }
+    }
+
+    // Remove the first tone and one from the middle. The rest should carry on undisturbed.
+    bank.removeTone( toneIds[ 2 ] );
+    gens.erase( gens.begin() + 2 );
+    mags.erase( mags.begin() + 2 );
+    bank.removeTone( toneIds[ 0 ] );
+    gens.erase( gens.begin() );
+    mags.erase( mags.begin() );
+
+    // And, add another tone to the end.
+    bank.addTone( 1.25, 0.3, 0.75 );
+    gens.emplace_back( 1.25, 0.3 );
+    mags.push_back( 0.75 );
+
+    for ( auto numSamples : requestSizes )
+    {
+        perInstance( gens, mags, goldenElementBuf.get(), numSamples, false );
+        bank.getSamples( testElementBuf.get(), numSamples );
+        if ( !compare( testElementBuf.get(), goldenElementBuf.get(), numSamples ) )
+        {
+            std::cout << "Failed getSamples after removal test for request size " << numSamples << std::endl;
+            return 4;
+        }
+    }
+
+    return 0;
+}
+
+int runEmptyBankAndUnknownToneTest()
+{
+    constexpr size_t NUM_SAMPLES = 100;
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        testElementBuf[ i ] = FlyingPhasorElementType{ 1.0, 1.0 };
+
+    // An empty bank should deliver zeros.
+    FlyingPhasorToneBank bank{};
+    bank.getSamples( testElementBuf.get(), NUM_SAMPLES );
+    for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+    {
+        if ( FlyingPhasorElementType{} != testElementBuf[ i ] )
+        {
+            std::cout << "Empty bank should deliver zeros and delivered " << testElementBuf[ i ] << " at index " << i << std::endl;
+            return 11;
+        }
+    }
+
+    // Identifiers are never reused, so a removed tone is unknown.
+    auto toneId = bank.addTone( 0.5 );
+    bank.removeTone( toneId );
+    bank.addTone( 0.5 );
+    try
+    {
+        bank.retuneTone( toneId, 0.25 );
+        std::cout << "Retuning an unknown tone should throw std::invalid_argument" << std::endl;
+        return 12;
+    }
+    catch ( const std::invalid_argument & )
+    {
+    }
+
+    return 0;
+}
+
+int runRetuneTest()
+{
+    constexpr size_t NUM_SAMPLES = 200;
+    std::unique_ptr< FlyingPhasorElementType[] > testElementBuf{new FlyingPhasorElementType[NUM_SAMPLES] };
+
+    FlyingPhasorToneBank bank{};
+    auto toneId = bank.addTone( 0.2, 0.0 );
+    FlyingPhasorToneGenerator gen{ 0.2, 0.0 };
+    bank.getSamples( testElementBuf.get(), NUM_SAMPLES );
+    gen.getSamples( testElementBuf.get(), NUM_SAMPLES );
+
+    // Retuning is phase continuous. The next sample is the one that would have been delivered anyway.
+    constexpr double newRate = -0.6;
+    bank.retuneTone( toneId, newRate );
+    bank.getSamples( testElementBuf.get(), NUM_SAMPLES );
+    if ( testElementBuf[ 0 ] != gen.peekNextSample() )
+    {
+        std::cout << "Retune should be phase continuous. Got " << testElementBuf[ 0 ] << " expected " << gen.peekNextSample() << std::endl;
+        return 21;
+    }
+
+    // And, the phase should now be advancing at the new rate.
+    for ( size_t i = 1; NUM_SAMPLES != i; ++i )
+    {
+        auto delta = deltaAngle( std::arg( testElementBuf[ i - 1 ] ), std::arg( testElementBuf[ i ] ) );
+        if ( !inTolerance( delta, newRate, 1e-12 ) )
+        {
+            std::cout << "Retuned rate should be " << newRate << " and is " << delta << " at index " << i << std::endl;
+            return 22;
+        }
+    }
+
+    return 0;
+}
+
+int runFixedPointTest()
+{
+    std::unique_ptr< FlyingPhasorElementType[] > goldenElementBuf{new FlyingPhasorElementType[MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorSC16Type[] > iq16Buf{new FlyingPhasorSC16Type[2 * MAX_REQUEST] };
+    std::unique_ptr< FlyingPhasorSC8Type[] > iq8Buf{new FlyingPhasorSC8Type[2 * MAX_REQUEST] };
+    std::vector< double > prior( 2 * MAX_REQUEST );
+
+    // Twin banks. One delivers complex samples, the golden standard, and the other fixed point.
+    FlyingPhasorToneBank goldenBank{};
+    FlyingPhasorToneBank bank{};
+    double sumOfMagnitudes = 0.0;
+    for ( const auto & spec : toneSpecs )
+    {
+        goldenBank.addTone( spec.radiansPerSample, spec.phi, spec.magnitude );
+        bank.addTone( spec.radiansPerSample, spec.phi, spec.magnitude );
+        sumOfMagnitudes += spec.magnitude;
+    }
+
+    // Comfortably short of saturation. The sum is rounded once, so it is within half an LSB of the golden sum
+    // scaled, but for the odd ULP by which chunked generation may differ and tip a rounding. Hence, one LSB.
+    const double fullScaleGain = 0.75 / sumOfMagnitudes;
+    for ( size_t r = 0; sizeof( requestSizes ) / sizeof( requestSizes[ 0 ] ) != r; ++r )
+    {
+        const size_t numSamples = requestSizes[ r ];
+        const bool accumulate = 1 == r % 2;
+        for ( size_t i = 0; 2 * numSamples != i; ++i )
+        {
+            prior[ i ] = accumulate ? double( int( i % 2001 ) - 1000 ) : 0.0;
+            iq16Buf[ i ] = FlyingPhasorSC16Type( prior[ i ] );
+        }
+
+        goldenBank.getSamples( goldenElementBuf.get(), numSamples );
+        if ( accumulate )
+            bank.accumSamplesSC16( iq16Buf.get(), numSamples, fullScaleGain );
+        else
+            bank.getSamplesSC16( iq16Buf.get(), numSamples, fullScaleGain );
+
+        for ( size_t i = 0; 2 * numSamples != i; ++i )
+        {
+            const auto & golden = goldenElementBuf[ i / 2 ];
+            const double component = 0 == i % 2 ? golden.real() : golden.imag();
+            const double expected = std::round( component * fullScaleGain * 32767.0 + prior[ i ] );
+            if ( 1.0 < std::fabs( expected - double( iq16Buf[ i ] ) ) )
+            {
+                std::cout << "SC16 component " << i << " of request " << r << " is " << iq16Buf[ i ]
+                          << ", expected " << expected << std::endl;
+                return 31;
+            }
+        }
+    }
+
+    // The 8 bit form, with dither. Dither spans plus or minus one LSB, so within two of the golden sum.
+    const size_t numSamples = MAX_REQUEST;
+    goldenBank.getSamples( goldenElementBuf.get(), numSamples );
+    bank.getSamplesSC8( iq8Buf.get(), numSamples, fullScaleGain, true );
+    for ( size_t i = 0; 2 * numSamples != i; ++i )
+    {
+        const auto & golden = goldenElementBuf[ i / 2 ];
+        const double component = 0 == i % 2 ? golden.real() : golden.imag();
+        if ( 2.0 < std::fabs( component * fullScaleGain * 127.0 - double( iq8Buf[ i ] ) ) )
+        {
+            std::cout << "SC8 component " << i << " is " << int( iq8Buf[ i ] ) << std::endl;
+            return 32;
+        }
+    }
+
+    // A gain that is not finite is rejected, leaving the buffer as it was.
+    for ( size_t i = 0; 2 * numSamples != i; ++i )
+        iq16Buf[ i ] = FlyingPhasorSC16Type( 1 + i % 1000 );
+    try
+    {
+        bank.accumSamplesSC16( iq16Buf.get(), numSamples, std::nan( "" ) );
+        std::cout << "A NaN gain should throw std::invalid_argument" << std::endl;
+        return 33;
+    }
+    catch ( const std::invalid_argument & )
+    {
+    }
+    for ( size_t i = 0; 2 * numSamples != i; ++i )
+    {
+        if ( FlyingPhasorSC16Type( 1 + i % 1000 ) != iq16Buf[ i ] )
+            return 34;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    int retCode = 0;
+
+    // For maximum view of significant digits for diagnostic purposes.
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // The bank should deliver the same samples as the per instance path, bit for bit.
+        retCode = runBankVersusPerInstanceTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runEmptyBankAndUnknownToneTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runRetuneTest();
+        if ( 0 != retCode )
+            break;
+
+        retCode = runFixedPointTest();
+        if ( 0 != retCode )
+            break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}